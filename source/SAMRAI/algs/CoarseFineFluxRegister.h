@@ -0,0 +1,308 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2017 Lawrence Livermore National Security, LLC
+ * Description:   Sparse flux registers on coarse-fine boundaries.
+ *
+ ************************************************************************/
+
+#ifndef included_algs_CoarseFineFluxRegister
+#define included_algs_CoarseFineFluxRegister
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/BoxId.h"
+#include "SAMRAI/hier/IntVector.h"
+#include "SAMRAI/hier/LocalId.h"
+#include "SAMRAI/hier/PatchHierarchy.h"
+#include "SAMRAI/hier/PatchLevel.h"
+#include "SAMRAI/tbox/Dimension.h"
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
+#include "SAMRAI/tbox/Timer.h"
+
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace SAMRAI {
+namespace algs {
+
+/*!
+ * @brief Flux integrals accumulated only on the coarse-fine boundary of
+ * each level, used to reflux the next coarser level.
+ *
+ * For each level finer than level zero the register holds one segment
+ * per codimension-one coarse-fine boundary box of each local patch,
+ * computed once per regrid from hier::CoarseFineBoundary.  A segment
+ * stores, at the resolution of the coarser level, the sum over time
+ * steps of the area-weighted average of the fine fluxes over each
+ * coarse face.  On a Cartesian mesh this is the value the
+ * CONSERVATIVE_COARSEN operator computes from outerface flux sums, but
+ * no storage is kept on the patch boundaries interior to the level or
+ * on physical boundaries, and only coarse-fine faces are communicated.
+ *
+ * Refluxing writes the register values into the flux data of every
+ * coarse patch whose face box contains the coarse faces, including
+ * periodic images, exactly where the coarsen schedule would have
+ * written them.  Communication goes directly between the owners of
+ * the fine and coarse patches and uses the fine-to-coarse Connector of
+ * the hierarchy and its transpose to determine the message partners.
+ *
+ * The flux data may be face-centered or side-centered but not a mix,
+ * as required by HyperbolicLevelIntegrator.  Only single-block
+ * geometries are supported.
+ *
+ * @see HyperbolicLevelIntegrator
+ */
+class CoarseFineFluxRegister
+{
+public:
+   /*!
+    * @brief Constructor.
+    *
+    * @param[in] object_name Name used in error reporting.
+    * @param[in] dim
+    * @param[in] flux_is_face True for FaceData fluxes, false for
+    *                         SideData fluxes.
+    *
+    * @pre !object_name.empty()
+    */
+   CoarseFineFluxRegister(
+      const std::string& object_name,
+      const tbox::Dimension& dim,
+      bool flux_is_face);
+
+   ~CoarseFineFluxRegister();
+
+   /*!
+    * @brief Add a flux patch data component to the register.
+    *
+    * All fluxes must be registered before the first call to
+    * resetLevels().
+    *
+    * @param[in] flux_id Patch data index of the flux, on both the fine
+    *                    and the coarse level.
+    * @param[in] depth Depth of the flux data.
+    *
+    * @pre flux_id >= 0
+    * @pre depth > 0
+    */
+   void
+   registerFlux(
+      int flux_id,
+      int depth);
+
+   /*!
+    * @brief Recompute the register segments of levels changed by a
+    * regrid.
+    *
+    * Each segment of a level depends on the level and on the next
+    * coarser level, so the registers of levels coarsest_level through
+    * finest_level of the hierarchy are recomputed.  Registers of levels
+    * beyond the finest hierarchy level are discarded.  This is a
+    * collective operation on the levels' communicator, since the
+    * hierarchy's Connectors may be computed and the first call
+    * duplicates the hierarchy's communicator for the refluxing messages.
+    *
+    * @param[in] hierarchy
+    * @param[in] coarsest_level
+    *
+    * @pre hierarchy
+    * @pre coarsest_level >= 0
+    */
+   void
+   resetLevels(
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+      int coarsest_level);
+
+   /*!
+    * @brief Set the register values of a level to zero.
+    *
+    * @pre level_number < number of levels in the register
+    */
+   void
+   zeroLevel(
+      int level_number);
+
+   /*!
+    * @brief Add the fluxes of a level to its register.
+    *
+    * The registered flux data must be allocated on every patch of
+    * fine_level.  This method is local.
+    *
+    * @pre fine_level.getLevelNumber() > 0
+    */
+   void
+   accumulateFluxes(
+      const hier::PatchLevel& fine_level);
+
+   /*!
+    * @brief Replace the fluxes of the coarse level on the coarse-fine
+    * boundary of the fine level with the register values.
+    *
+    * The registered flux data must be allocated on every patch of
+    * coarse_level.
+    *
+    * @pre coarse_level.getLevelNumber() == fine_level.getLevelNumber() - 1
+    */
+   void
+   reflux(
+      const hier::PatchLevel& fine_level,
+      const hier::PatchLevel& coarse_level);
+
+   /*!
+    * @brief Return the number of values held locally by the register of
+    * a level.
+    */
+   size_t
+   getNumberOfRegisterValues(
+      int level_number) const;
+
+   /*!
+    * @brief Return the name of this object.
+    */
+   const std::string&
+   getObjectName() const
+   {
+      return d_object_name;
+   }
+
+   /*!
+    * @brief Print the register sizes.
+    */
+   void
+   printClassData(
+      std::ostream& os) const;
+
+private:
+   // The following are not implemented:
+   CoarseFineFluxRegister(
+      const CoarseFineFluxRegister&);
+
+   CoarseFineFluxRegister&
+   operator = (
+      const CoarseFineFluxRegister&);
+
+   /*
+    * Tags for the refluxing messages, which are sent on d_mpi.
+    */
+   static const int CoarseFineFluxRegister_TAG0 = 1;
+   static const int CoarseFineFluxRegister_TAG1 = 2;
+
+   /*
+    * Length of the first message of each reflux exchange, in bytes.
+    */
+   static const int CoarseFineFluxRegister_FIRSTDATALEN = 1024;
+
+   /*
+    * Part of a segment going to one coarse patch.  d_faces is in the
+    * index space of the segment and d_shift moves it to the index space
+    * of the coarse patch (non-zero for periodic images).
+    */
+   struct Destination {
+      Destination(
+         const hier::BoxId& coarse_box_id,
+         const hier::Box& faces,
+         const hier::IntVector& shift):
+         d_coarse_box_id(coarse_box_id),
+         d_faces(faces),
+         d_shift(shift)
+      {
+      }
+      hier::BoxId d_coarse_box_id;
+      hier::Box d_faces;
+      hier::IntVector d_shift;
+   };
+
+   /*
+    * Register for the part of one patch side on the coarse-fine
+    * boundary.  d_fine_faces and d_coarse_faces are cell-like boxes
+    * whose extent in d_axis is the single face position.  d_values
+    * holds, for each flux component in turn, one value for each coarse
+    * face ordered by hier::Box::offset() in d_coarse_faces.
+    */
+   struct Segment {
+      explicit Segment(
+         const tbox::Dimension& dim):
+         d_axis(0),
+         d_fine_faces(dim),
+         d_coarse_faces(dim)
+      {
+      }
+      hier::BoxId d_fine_box_id;
+      int d_axis;
+      hier::Box d_fine_faces;
+      hier::Box d_coarse_faces;
+      std::vector<double> d_values;
+      std::vector<Destination> d_destinations;
+   };
+
+   struct LevelRegister {
+      std::vector<Segment> d_segments;
+      std::set<int> d_send_ranks;
+      std::set<int> d_recv_ranks;
+   };
+
+   /*
+    * Compute the register of one level.
+    */
+   void
+   computeLevelRegister(
+      const hier::PatchHierarchy& hierarchy,
+      int level_number);
+
+   /*
+    * Copy the values of a segment for the faces in faces, a box in the
+    * index space of the segment, into values.  The values of each flux
+    * component are contiguous and ordered by hier::Box::offset() in
+    * faces.
+    */
+   void
+   extractValues(
+      const Segment& segment,
+      const hier::Box& faces,
+      std::vector<double>& values) const;
+
+   /*
+    * Write values, laid out as by extractValues(), into the flux data
+    * normal to axis on the faces dst_faces of a coarse patch.
+    */
+   void
+   writeToCoarsePatch(
+      hier::Patch& coarse_patch,
+      int axis,
+      const hier::Box& dst_faces,
+      const double* values) const;
+
+   std::string d_object_name;
+
+   const tbox::Dimension d_dim;
+
+   bool d_flux_is_face;
+
+   std::vector<int> d_flux_ids;
+   std::vector<int> d_flux_depths;
+   int d_num_components;
+
+   std::vector<LevelRegister> d_levels;
+
+   /*
+    * Private communicator for the refluxing messages, duplicated from
+    * the hierarchy's communicator in resetLevels().
+    */
+   tbox::SAMRAI_MPI d_mpi;
+
+   std::shared_ptr<tbox::Timer> t_reset_levels;
+   std::shared_ptr<tbox::Timer> t_accumulate;
+   std::shared_ptr<tbox::Timer> t_reflux;
+};
+
+}
+}
+
+#endif
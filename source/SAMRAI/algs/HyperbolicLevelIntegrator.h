@@ -14,6 +14,7 @@
 
 #include "SAMRAI/SAMRAI_config.h"
 
+#include "SAMRAI/algs/CoarseFineFluxRegister.h"
 #include "SAMRAI/algs/HyperbolicPatchStrategy.h"
 #include "SAMRAI/algs/HyperbolicPatchStrategy.h"
 #include "SAMRAI/algs/TimeRefinementLevelStrategy.h"
@@ -102,6 +103,15 @@ namespace algs {
  *       indicates whether ghost data must be filled before timestep is
  *       computed on each patch (possible communication optimization)
  *
+ *    - \b    use_sparse_flux_registers
+ *       indicates whether fine flux integrals are accumulated only on the
+ *       coarse-fine boundary, in a CoarseFineFluxRegister, rather than in
+ *       outerface (or outerside) data on every patch boundary.  The
+ *       registers are used only when every FLUX variable is coarsened with
+ *       the "CONSERVATIVE_COARSEN" operator on a single-block
+ *       geom::CartesianGridGeometry; otherwise the outerface data is used
+ *       regardless of this value.  The default is FALSE.
+ *
  * Note that when continuing from restart, the input parameters in the input
  * database override all values read in from the restart database.
  *
@@ -147,6 +157,14 @@ namespace algs {
  *     <td>opt</td>
  *     <td>Parameter read from restart db may be overridden by input db</td>
  *   </tr>
+ *   <tr>
+ *     <td>use_sparse_flux_registers</td>
+ *     <td>bool</td>
+ *     <td>FALSE</td>
+ *     <td>TRUE, FALSE</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
  * </table>
  *
  * A sample input file entry might look like:
@@ -912,6 +930,16 @@ private:
       const hier::PatchLevel& patch_level,
       double current_time);
 
+   /*
+    * Return whether flux integrals are accumulated in d_flux_register
+    * instead of the outerface data in d_fluxsum_data.
+    */
+   bool
+   usesSparseFluxRegisters() const
+   {
+      return d_use_sparse_flux_registers && d_flux_register_applies;
+   }
+
    /*
     * The patch strategy supplies the application-specific operations
     * needed to treat data on patches in the AMR hierarchy.
@@ -973,6 +1001,18 @@ private:
    bool d_flux_face_registered;
    bool d_flux_side_registered;
 
+   /*
+    * d_use_sparse_flux_registers is the input request for sparse flux
+    * registers and d_flux_register_applies records whether every FLUX
+    * variable was registered with CONSERVATIVE_COARSEN, which the
+    * registers reproduce, on a single-block geometry.  d_flux_register
+    * is created with the first FLUX variable and used only when both
+    * are true.
+    */
+   bool d_use_sparse_flux_registers;
+   bool d_flux_register_applies;
+   std::shared_ptr<CoarseFineFluxRegister> d_flux_register;
+
 /*
  * The following communication algorithms and schedules are created and
  * maintained to manage inter-patch communication during AMR integration.
@@ -49,6 +49,12 @@ namespace algs {
  *    - \b max_integrator_steps
  *       maximum number of timesteps performed on the coarsest hierarchy level
  *       during the simulation.
+ *    - \b precond_dt_change_tolerance
+ *       relative change in the time step size up to which the nonlinear
+ *       solver may keep reusing its preconditioner across time steps (see
+ *       solv::NonlinearSolverStrategy::resetPreconditioner()).  A larger
+ *       change, the first step, and the first step after regridding make
+ *       the solver set it up afresh.
  *
  * All input data items described above, except for initial_time, may be
  * overridden by new input values when continuing from restart.
@@ -87,6 +93,14 @@ namespace algs {
  *     <td>req</td>
  *     <td>Parameter read from restart db may be overridden by input db</td>
  *   </tr>
+ *   <tr>
+ *     <td>precond_dt_change_tolerance</td>
+ *     <td>double</td>
+ *     <td>0.0</td>
+ *     <td>>=0</td>
+ *     <td>opt</td>
+ *     <td>Parameter read from restart db may be overridden by input db</td>
+ *   </tr>
  * </table>
  *
  * A sample input file entry might look like:
@@ -271,6 +285,35 @@ public:
       return d_integrator_step < d_max_integrator_steps;
    }
 
+   /**
+    * Return the number of nonlinear solves performed.
+    */
+   int
+   getNumberOfSolves() const
+   {
+      return d_num_solves;
+   }
+
+   /**
+    * Return the number of solves for which the nonlinear solver was
+    * asked to set up its preconditioner afresh.
+    */
+   int
+   getNumberOfPreconditionerResets() const
+   {
+      return d_num_precond_resets;
+   }
+
+   /**
+    * Return the wall clock time in seconds spent in nonlinear solves on
+    * this process.
+    */
+   double
+   getSolveTime() const
+   {
+      return d_solve_time;
+   }
+
    /**
     * Print out all members of integrator instance to given output stream.
     */
@@ -354,6 +397,21 @@ private:
    int d_integrator_step;
    int d_max_integrator_steps;
 
+   /*
+    * Preconditioner reuse across time steps: the time step size for
+    * which the nonlinear solver last set up its preconditioner and the
+    * relative change in it that requires a new setup.
+    */
+   double d_precond_dt_change_tolerance;
+   double d_precond_dt;
+
+   /*
+    * Solve statistics.
+    */
+   int d_num_solves;
+   int d_num_precond_resets;
+   double d_solve_time;
+
    // The following are not implemented:
    ImplicitIntegrator(
       const ImplicitIntegrator&);
@@ -92,6 +92,33 @@ namespace appu {
 
 struct CartesianBoundaryUtilities2 {
 public:
+   /*!
+    * @brief A variable whose boundary values are set by fillBoundaryData(),
+    * with the boundary condition types and values that apply to it.
+    *
+    * The arrays are those that would be passed to fillEdgeBoundaryData()
+    * and fillNodeBoundaryData() for the variable.  They are referenced,
+    * not copied, and must outlive the call to fillBoundaryData().
+    */
+   struct BoundaryFillVariable {
+      BoundaryFillVariable(
+         const std::shared_ptr<pdat::CellData<double> >& vardata,
+         const std::vector<int>& bdry_edge_conds,
+         const std::vector<int>& bdry_node_conds,
+         const std::vector<double>& bdry_edge_values):
+         d_data(vardata),
+         d_edge_conds(&bdry_edge_conds),
+         d_node_conds(&bdry_node_conds),
+         d_edge_values(&bdry_edge_values)
+      {
+      }
+
+      std::shared_ptr<pdat::CellData<double> > d_data;
+      const std::vector<int>* d_edge_conds;
+      const std::vector<int>* d_node_conds;
+      const std::vector<double>* d_edge_values;
+   };
+
    /*!
     * Function to read 2d boundary data from input database.
     * The integer boundary condition types are placed in the integer
@@ -204,6 +231,37 @@ public:
       const std::vector<int>& bdry_node_conds,
       const std::vector<double>& bdry_edge_values);
 
+   /*!
+    * Function to fill 2d edge and node boundary values of several
+    * variables on a patch.
+    *
+    * The result is the same as calling fillEdgeBoundaryData() and then
+    * fillNodeBoundaryData() for each variable, but all variables are
+    * filled together for each boundary box of the patch, and the
+    * boundary conditions are applied by C++ loops over contiguous rows
+    * of cells that the compiler can vectorize, instead of one FORTRAN
+    * call per variable and boundary box.  Edge boxes of all variables
+    * are filled before node boxes, since node values may be copied from
+    * edge ghost cells.
+    *
+    * @param variables           Variables to fill, with their boundary
+    *                            condition types and values.
+    * @param patch               hier::Patch on which the data objects live.
+    * @param ghost_width_to_fill Width of ghost region to fill.
+    *
+    * @pre for each variable, d_data is non-null,
+    *      d_edge_conds->size() == NUM_2D_EDGES,
+    *      d_node_conds->size() == NUM_2D_NODES and
+    *      d_edge_values->size() == NUM_2D_EDGES * d_data->getDepth()
+    * @pre ghost_width_to_fill.getDim() == tbox::Dimension(2)
+    * @pre patch.getDim() == ghost_width_to_fill.getDim()
+    */
+   static void
+   fillBoundaryData(
+      const std::vector<BoundaryFillVariable>& variables,
+      const hier::Patch& patch,
+      const hier::IntVector& ghost_width_to_fill);
+
    /*!
     * Function that returns the integer edge boundary location
     * corresponding to the given node location and node boundary
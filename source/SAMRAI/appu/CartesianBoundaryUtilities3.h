@@ -113,6 +113,37 @@ namespace appu {
 
 struct CartesianBoundaryUtilities3 {
 public:
+   /*!
+    * @brief A variable whose boundary values are set by fillBoundaryData(),
+    * with the boundary condition types and values that apply to it.
+    *
+    * The arrays are those that would be passed to fillFaceBoundaryData(),
+    * fillEdgeBoundaryData() and fillNodeBoundaryData() for the variable.
+    * They are referenced, not copied, and must outlive the call to
+    * fillBoundaryData().
+    */
+   struct BoundaryFillVariable {
+      BoundaryFillVariable(
+         const std::shared_ptr<pdat::CellData<double> >& vardata,
+         const std::vector<int>& bdry_face_conds,
+         const std::vector<int>& bdry_edge_conds,
+         const std::vector<int>& bdry_node_conds,
+         const std::vector<double>& bdry_face_values):
+         d_data(vardata),
+         d_face_conds(&bdry_face_conds),
+         d_edge_conds(&bdry_edge_conds),
+         d_node_conds(&bdry_node_conds),
+         d_face_values(&bdry_face_values)
+      {
+      }
+
+      std::shared_ptr<pdat::CellData<double> > d_data;
+      const std::vector<int>* d_face_conds;
+      const std::vector<int>* d_edge_conds;
+      const std::vector<int>* d_node_conds;
+      const std::vector<double>* d_face_values;
+   };
+
    /*!
     * Function to read 3d boundary data from input database.
     * The integer boundary condition types are placed in the integer
@@ -263,6 +294,39 @@ public:
       const std::vector<int>& bdry_node_conds,
       const std::vector<double>& bdry_face_values);
 
+   /*!
+    * Function to fill 3d face, edge and node boundary values of several
+    * variables on a patch.
+    *
+    * The result is the same as calling fillFaceBoundaryData(),
+    * fillEdgeBoundaryData() and then fillNodeBoundaryData() for each
+    * variable, but all variables are filled together for each boundary
+    * box of the patch, and the boundary conditions are applied by C++
+    * loops over contiguous rows of cells that the compiler can vectorize,
+    * instead of one FORTRAN call per variable and boundary box.  Face
+    * boxes of all variables are filled before edge boxes, and edge boxes
+    * before node boxes, since edge and node values may be copied from
+    * ghost cells of lower codimension.
+    *
+    * @param variables           Variables to fill, with their boundary
+    *                            condition types and values.
+    * @param patch               hier::Patch on which the data objects live.
+    * @param ghost_width_to_fill Width of ghost region to fill.
+    *
+    * @pre for each variable, d_data is non-null,
+    *      d_face_conds->size() == NUM_3D_FACES,
+    *      d_edge_conds->size() == NUM_3D_EDGES,
+    *      d_node_conds->size() == NUM_3D_NODES and
+    *      d_face_values->size() == NUM_3D_FACES * d_data->getDepth()
+    * @pre ghost_width_to_fill.getDim() == tbox::Dimension(3)
+    * @pre patch.getDim() == ghost_width_to_fill.getDim()
+    */
+   static void
+   fillBoundaryData(
+      const std::vector<BoundaryFillVariable>& variables,
+      const hier::Patch& patch,
+      const hier::IntVector& ghost_width_to_fill);
+
    /*!
     * Function that returns the integer face boundary location
     * corresponding to the given edge location and edge boundary
@@ -0,0 +1,322 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2017 Lawrence Livermore National Security, LLC
+ * Description:   In-situ reductions of patch data on a hierarchy
+ *
+ ************************************************************************/
+
+#ifndef included_appu_InSituAnalysis
+#define included_appu_InSituAnalysis
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/BoxContainer.h"
+#include "SAMRAI/hier/Patch.h"
+#include "SAMRAI/hier/PatchHierarchy.h"
+#include "SAMRAI/tbox/Dimension.h"
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
+#include "SAMRAI/tbox/Timer.h"
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace SAMRAI {
+namespace appu {
+
+/*!
+ * @brief Class InSituAnalysis computes small global diagnostics of
+ * cell-centered double data on a patch hierarchy while the simulation
+ * runs, and appends them to a text file, so that full plot files need
+ * not be written just to compute them afterwards.
+ *
+ * The diagnostics are registered once and computed by every call to
+ * analyze():
+ *
+ *   - histogram: the volume (area in 2D) of the cells whose value lies
+ *     in each of num_bins equal bins between a lower and an upper bound,
+ *     plus the volume below and above the bounds.
+ *
+ *   - slice: the values of the cells cut by an axis-aligned plane (a
+ *     line in 2D), with their level numbers and cell centers.
+ *
+ *   - probe: the value of the cell containing a point.
+ *
+ *   - box integral: the integral, the volume and the minimum and maximum
+ *     of the values over an axis-aligned box in physical coordinates.
+ *     Cells partly inside the box contribute in proportion to their
+ *     overlap.
+ *
+ * All diagnostics use the composite grid: a cell covered by a finer
+ * level is skipped, so each point of the domain counts once, at the
+ * finest resolution.  The covered cells are found with the Connectors
+ * of the hierarchy, without globalizing the levels.  Patch data are
+ * read in place; the mesh must be managed by a
+ * geom::CartesianGridGeometry.
+ *
+ * The histograms, probes and box integrals of all diagnostics are
+ * reduced together with one sum, one min and one max reduction, so the
+ * communication does not grow with the number of diagnostics.  Slices
+ * are gathered to the first process, which writes the output.
+ *
+ * analyze() may be called at any step, independently of plot dumps.  A
+ * VisItDataWriter can also be given the object with its
+ * registerInSituAnalysis() method to call analyze() at each dump.
+ *
+ * Each call appends a block to the output file beginning with the line
+ * "step <time step> time <time>", followed by one line per histogram,
+ * probe and box integral, and for each slice a header line followed by
+ * one line per cell.
+ *
+ * @see VisItDataWriter
+ */
+
+class InSituAnalysis
+{
+public:
+   /*!
+    * @brief Constructor.
+    *
+    * @param dim
+    * @param object_name
+    * @param output_filename Name of the file the results are appended to.
+    * @param mpi Processes taking part in the reductions.
+    *
+    * @pre !object_name.empty()
+    * @pre !output_filename.empty()
+    */
+   InSituAnalysis(
+      const tbox::Dimension& dim,
+      const std::string& object_name,
+      const std::string& output_filename,
+      const tbox::SAMRAI_MPI& mpi = tbox::SAMRAI_MPI::getSAMRAIWorld());
+
+   /*!
+    * @brief Destructor.
+    */
+   ~InSituAnalysis();
+
+   /*!
+    * @brief Register a histogram of one component of cell-centered
+    * double data.
+    *
+    * @param name Name of the histogram in the output.
+    * @param data_id Patch data index of the data.
+    * @param depth Component of the data.
+    * @param lower Lower bound of the first bin.
+    * @param upper Upper bound of the last bin.
+    * @param num_bins Number of bins.
+    *
+    * @pre !name.empty()
+    * @pre data_id >= 0
+    * @pre depth >= 0
+    * @pre lower < upper
+    * @pre num_bins > 0
+    */
+   void
+   registerHistogram(
+      const std::string& name,
+      int data_id,
+      int depth,
+      double lower,
+      double upper,
+      int num_bins);
+
+   /*!
+    * @brief Register a slice of one component of cell-centered double
+    * data, at a coordinate along an axis.
+    *
+    * @pre !name.empty()
+    * @pre data_id >= 0
+    * @pre depth >= 0
+    * @pre (axis >= 0) && (axis < dim)
+    */
+   void
+   registerSlice(
+      const std::string& name,
+      int data_id,
+      int depth,
+      int axis,
+      double coordinate);
+
+   /*!
+    * @brief Register a probe of one component of cell-centered double
+    * data at a point.
+    *
+    * @pre !name.empty()
+    * @pre data_id >= 0
+    * @pre depth >= 0
+    * @pre point.size() == dim
+    */
+   void
+   registerProbe(
+      const std::string& name,
+      int data_id,
+      int depth,
+      const std::vector<double>& point);
+
+   /*!
+    * @brief Register the integral of one component of cell-centered
+    * double data over a box.
+    *
+    * @pre !name.empty()
+    * @pre data_id >= 0
+    * @pre depth >= 0
+    * @pre lower.size() == dim && upper.size() == dim
+    */
+   void
+   registerBoxIntegral(
+      const std::string& name,
+      int data_id,
+      int depth,
+      const std::vector<double>& lower,
+      const std::vector<double>& upper);
+
+   /*!
+    * @brief Compute all registered diagnostics on the hierarchy and
+    * append them to the output file.  This is collective.
+    *
+    * @pre hierarchy
+    */
+   void
+   analyze(
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+      int time_step,
+      double simulation_time = 0.0);
+
+   /*!
+    * @brief Return the result of a diagnostic from the last call to
+    * analyze().
+    *
+    * The result is, for a histogram, the volumes below the lower bound,
+    * in each bin and above the upper bound; for a probe, the value and
+    * the number of cells found (0 if the point is outside the mesh); for
+    * a box integral, the integral, the volume, the minimum and the
+    * maximum.  These are the same on all processes.  For a slice it is,
+    * on the first process only, one record per cell made of the level
+    * number, the dim coordinates of the cell center and the value.
+    *
+    * @pre a diagnostic called name is registered
+    */
+   const std::vector<double>&
+   getResult(
+      const std::string& name) const;
+
+   /*!
+    * @brief Return the name of this object.
+    */
+   const std::string&
+   getObjectName() const
+   {
+      return d_object_name;
+   }
+
+   /*!
+    * @brief Print out all members of the class instance to given output
+    * stream.
+    */
+   void
+   printClassData(
+      std::ostream& os) const;
+
+private:
+   enum DiagnosticType { HISTOGRAM, SLICE, PROBE, BOX_INTEGRAL };
+
+   /*
+    * A registered diagnostic.  d_sum_offset and d_extremum_offset locate
+    * its entries in the arrays that are reduced.
+    */
+   struct Diagnostic {
+      std::string d_name;
+      DiagnosticType d_type;
+      int d_data_id;
+      int d_depth;
+      double d_lower;
+      double d_upper;
+      int d_num_bins;
+      int d_axis;
+      std::vector<double> d_point;
+      std::vector<double> d_box_upper;
+      int d_sum_offset;
+      int d_extremum_offset;
+      std::vector<double> d_result;
+   };
+
+   /*
+    * Unimplemented copy constructor and assignment.
+    */
+   InSituAnalysis(
+      const InSituAnalysis&);
+   InSituAnalysis&
+   operator = (
+      const InSituAnalysis&);
+
+   /*
+    * Check the common arguments of the register methods and add a
+    * diagnostic.
+    */
+   Diagnostic&
+   addDiagnostic(
+      const std::string& name,
+      DiagnosticType type,
+      int data_id,
+      int depth);
+
+   /*
+    * Add the contribution of the cells of a patch in the given boxes to
+    * one diagnostic.
+    */
+   void
+   accumulatePatch(
+      const Diagnostic& diagnostic,
+      const hier::Patch& patch,
+      const hier::BoxContainer& uncovered_boxes,
+      int level_number,
+      std::vector<double>& sums,
+      std::vector<double>& minima,
+      std::vector<double>& maxima,
+      std::vector<double>& slice_records);
+
+   /*
+    * Gather the slice records to the first process and store them in the
+    * results.
+    */
+   void
+   gatherSlices(
+      std::vector<double>& slice_records);
+
+   /*
+    * Append the results to the output file on the first process.
+    */
+   void
+   writeResults(
+      int time_step,
+      double simulation_time) const;
+
+   const tbox::Dimension d_dim;
+
+   std::string d_object_name;
+
+   std::string d_output_filename;
+
+   tbox::SAMRAI_MPI d_mpi;
+
+   std::vector<Diagnostic> d_diagnostics;
+
+   /*
+    * Sizes of the arrays that are sum and min/max reduced.
+    */
+   int d_num_sums;
+   int d_num_extrema;
+
+   std::shared_ptr<tbox::Timer> t_analyze;
+};
+
+}
+}
+
+#endif
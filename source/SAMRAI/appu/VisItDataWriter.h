@@ -20,6 +20,7 @@
  */
 #ifdef HAVE_HDF5
 
+#include "SAMRAI/appu/InSituAnalysis.h"
 #include "SAMRAI/appu/VisDerivedDataStrategy.h"
 #include "SAMRAI/appu/VisMaterialsDataStrategy.h"
 
@@ -142,6 +143,11 @@ namespace appu {
  *    - If using species of the materials, register the names of
  *      the species of each material using the registerSpeciesNames() method.
  *
+ *    - Optionally, register InSituAnalysis objects with
+ *      registerInSituAnalysis() to compute small diagnostics at each
+ *      dump; they can also be computed between dumps, so that full
+ *      dumps are needed less often.
+ *
  *    - The writer will generate VisIt dump files when the method
  *      writePlotData() is called.  Minimally, only a hierarchy and the
  *      time step number is needed.  A simulation time can also be
@@ -260,6 +266,23 @@ public:
       d_materials_writer = materials_data_writer;
    }
 
+   /*!
+    * @brief This method registers an in-situ analysis whose analyze()
+    * method is called by each writePlotData(), after the VisIt files
+    * are written.
+    *
+    * @param analysis Pointer to an InSituAnalysis object.
+    *
+    * @pre analysis != 0
+    */
+   void
+   registerInSituAnalysis(
+      InSituAnalysis* analysis)
+   {
+      TBOX_ASSERT(analysis != 0);
+      d_in_situ_analyses.push_back(analysis);
+   }
+
    /*!
     * @brief This method registers a variable with the VisIt data writer.
     *
@@ -1254,6 +1277,11 @@ private:
     */
    VisMaterialsDataStrategy* d_materials_writer;
 
+   /*
+    * In-situ analyses run at each dump.
+    */
+   std::vector<InSituAnalysis *> d_in_situ_analyses;
+
    /*
     * Directory into which VisIt files will be written.
     */
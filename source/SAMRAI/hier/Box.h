@@ -1473,10 +1473,13 @@ private:
  * \endverbatim
  * Note that the box iterator may not compile to efficient code, depending
  * on your compiler.  Many compilers are not smart enough to optimize the
- * looping constructs and indexing operations.
+ * looping constructs and indexing operations.  For loops over array data,
+ * BoxRowIterator provides rows of indices and their array offsets, so
+ * the innermost loop runs over contiguous memory.
  *
  * @see Index
  * @see Box
+ * @see BoxRowIterator
  */
 
 class BoxIterator
@@ -1536,13 +1539,14 @@ public:
       int)
    {
       BoxIterator tmp = *this;
-      ++d_index(0);
-      for (dir_t i = 0; i < (d_index.getDim().getValue() - 1); ++i) {
-         if (d_index(i) > d_box.upper(i)) {
-            d_index(i) = d_box.lower(i);
-            ++d_index(i + 1);
-         } else
-            break;
+      if (++d_index(0) > d_box.upper(0)) {
+         for (dir_t i = 0; i < (d_index.getDim().getValue() - 1); ++i) {
+            if (d_index(i) > d_box.upper(i)) {
+               d_index(i) = d_box.lower(i);
+               ++d_index(i + 1);
+            } else
+               break;
+         }
       }
       return tmp;
    }
@@ -1553,13 +1557,14 @@ public:
    BoxIterator&
    operator ++ ()
    {
-      ++d_index(0);
-      for (dir_t i = 0; i < (d_index.getDim().getValue() - 1); ++i) {
-         if (d_index(i) > d_box.upper(i)) {
-            d_index(i) = d_box.lower(i);
-            ++d_index(i + 1);
-         } else
-            break;
+      if (++d_index(0) > d_box.upper(0)) {
+         for (dir_t i = 0; i < (d_index.getDim().getValue() - 1); ++i) {
+            if (d_index(i) > d_box.upper(i)) {
+               d_index(i) = d_box.lower(i);
+               ++d_index(i + 1);
+            } else
+               break;
+         }
       }
       return *this;
    }
@@ -1752,6 +1752,16 @@ private:
    void
    computeLocalRedundantData();
 
+   /*!
+    * @brief Bring the memory accounted to tbox::MemoryUtilities up to
+    * date with the current numbers of local and global boxes.
+    *
+    * Each box is accounted with its list node and its node in the
+    * ordered set of the BoxContainer.
+    */
+   void
+   accountMemory();
+
    //@{
 
    /*!
@@ -2065,6 +2075,13 @@ private:
 
    bool d_locked;
 
+   /*!
+    * @brief Bytes of d_boxes and d_global_boxes accounted to
+    * tbox::MemoryUtilities::BOX_LEVELS and GLOBALIZED_BOX_LEVELS.
+    */
+   size_t d_accounted_local_memory;
+   size_t d_accounted_global_memory;
+
    /*!
     * @brief A LocalId object with value of -1.
     */
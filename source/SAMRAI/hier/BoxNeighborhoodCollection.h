@@ -129,6 +129,22 @@ private:
     */
    HeadBoxLinkCt d_nbr_link_ct;
 
+   /*
+    * Bytes accounted to tbox::MemoryUtilities::CONNECTORS.  The
+    * accounting follows the base Boxes, head Boxes and links as they are
+    * inserted and erased, counting each with its node in the ordered
+    * container holding it.
+    */
+   size_t d_accounted_memory;
+
+   void
+   recordMemory(
+      size_t bytes);
+
+   void
+   releaseMemory(
+      size_t bytes);
+
 public:
    // Constructors.
 
@@ -1164,6 +1180,16 @@ private:
    int
    sumNumNeighbors() const;
 
+   /*!
+    * @brief Returns the number of bytes used by the neighborhoods, as
+    * accounted to tbox::MemoryUtilities::CONNECTORS.
+    */
+   size_t
+   getMemoryUsage() const
+   {
+      return d_accounted_memory;
+   }
+
    /*!
     * @brief Returns true if nbr is a neighbor of the base Box with the
     * supplied BoxId.
@@ -0,0 +1,168 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2017 Lawrence Livermore National Security, LLC
+ * Description:   Iterator over the rows of a box
+ *
+ ************************************************************************/
+
+#ifndef included_hier_BoxRowIterator
+#define included_hier_BoxRowIterator
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/Index.h"
+
+namespace SAMRAI {
+namespace hier {
+
+/**
+ * Class BoxRowIterator iterates over the rows of a box, the runs of
+ * indices that differ only in direction 0.  Rows are enumerated in
+ * column-major order, the order of BoxIterator, and each row is contiguous
+ * in the storage of an array (such as pdat::ArrayData) over a box
+ * containing it.
+ *
+ * For each row the iterator provides the first index, the number of
+ * indices and the offset of the first index in the storage of an array
+ * over the array box given to the constructor, so that the innermost loop
+ * is a plain loop over contiguous memory that the compiler can vectorize:
+ *
+ * \verbatim
+ * const hier::Box& array_box = data.getArrayData().getBox();
+ * double* ptr = data.getPointer();
+ * for (hier::BoxRowIterator r(box, array_box); r.isValid(); ++r) {
+ *    double* row = ptr + r.getOffset();
+ *    for (int i = 0; i < r.getRowLength(); ++i) {
+ *       row[i] = 0.0;
+ *    }
+ * }
+ * \endverbatim
+ *
+ * Advancing to the next row updates the offset incrementally; no box is
+ * copied and no per-index work is done.
+ *
+ * @see BoxIterator
+ */
+
+class BoxRowIterator
+{
+public:
+   typedef tbox::Dimension::dir_t dir_t;
+
+   /**
+    * Construct an iterator over the rows of box, with offsets in the
+    * storage of an array over array_box.
+    *
+    * @pre box.empty() || array_box.contains(box)
+    */
+   BoxRowIterator(
+      const Box& box,
+      const Box& array_box);
+
+   /**
+    * Construct an iterator over the rows of box, with offsets in the
+    * storage of an array over box itself.
+    */
+   explicit BoxRowIterator(
+      const Box& box);
+
+   /**
+    * Return true while the iterator is at a row of the box.
+    */
+   bool
+   isValid() const
+   {
+      return d_valid;
+   }
+
+   /**
+    * Return the first index of the current row.
+    */
+   const Index&
+   getIndex() const
+   {
+      return d_index;
+   }
+
+   /**
+    * Return the number of indices in a row, the same for every row.
+    */
+   int
+   getRowLength() const
+   {
+      return d_row_length;
+   }
+
+   /**
+    * Return the offset of the first index of the current row in the
+    * storage of an array over the array box.
+    */
+   size_t
+   getOffset() const
+   {
+      return d_offset;
+   }
+
+   /**
+    * Advance to the next row.
+    */
+   BoxRowIterator&
+   operator ++ ()
+   {
+      if (d_index.getDim().getValue() == 1) {
+         d_valid = false;
+         return *this;
+      }
+      d_offset += d_stride[1];
+      if (++d_index(1) > d_upper(1)) {
+         carry();
+      }
+      return *this;
+   }
+
+private:
+   /*
+    * Move the row index into the box after direction 1 passed its upper
+    * bound, or mark the iterator invalid past the last row.
+    */
+   void
+   carry();
+
+   void
+   initialize(
+      const Box& box,
+      const Box& array_box);
+
+   /*
+    * Unimplemented default constructor, copy constructor and assignment.
+    */
+   BoxRowIterator();
+   BoxRowIterator(
+      const BoxRowIterator&);
+   BoxRowIterator&
+   operator = (
+      const BoxRowIterator&);
+
+   Index d_index;
+   Index d_lower;
+   Index d_upper;
+   int d_row_length;
+   size_t d_offset;
+
+   /*
+    * d_stride[d] is the distance in the array storage between indices
+    * one apart in direction d.
+    */
+   size_t d_stride[SAMRAI::MAX_DIM_VAL];
+
+   bool d_valid;
+};
+
+}
+}
+
+#endif
@@ -1329,6 +1329,16 @@ public:
       return d_relationships.sumNumNeighbors();
    }
 
+   /*!
+    * @brief Return the number of bytes used locally by the relationships.
+    */
+   size_t
+   getLocalMemoryUsage() const
+   {
+      return d_relationships.getMemoryUsage() +
+             d_global_relationships.getMemoryUsage();
+   }
+
    /*!
     * @brief Return global number of neighbor sets.
     *
@@ -22,6 +22,8 @@
 namespace SAMRAI {
 namespace hier {
 
+class Patch;
+
 /**
  * Class PatchData is a pure virtual base class for the data storage
  * defined over a box.  Patch data objects are generally contained within
@@ -270,11 +272,22 @@ protected:
    }
 
 private:
+   friend class Patch;
+
    /*
     * Static integer constant describing class's version number.
     */
    static const int HIER_PATCH_DATA_VERSION;
 
+   /*
+    * Account this object as patch data memory of the given size.  Patch
+    * calls this for objects it allocates through a PatchDataFactory, and
+    * the destructor releases the accounted size.
+    */
+   void
+   accountMemory(
+      size_t bytes);
+
    PatchData(
       const PatchData&);        // not implemented
    PatchData&
@@ -285,6 +298,7 @@ private:
    Box d_ghost_box;                     // interior box plus ghosts
    IntVector d_ghosts;                  // ghost cell width
    double d_timestamp;                          // timestamp for the data
+   size_t d_accounted_memory;                   // see accountMemory()
 
 };
 
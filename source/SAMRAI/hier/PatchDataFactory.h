@@ -177,6 +177,19 @@ public:
    validCopyTo(
       const std::shared_ptr<PatchDataFactory>& dst_pdf) const = 0;
 
+   /**
+    * @brief Return whether this factory and other make the same box
+    * geometry for every box.
+    *
+    * Schedules use this to compute overlaps once for patch data
+    * components with the same box geometries.  The default returns
+    * false, so overlaps are never shared.  Subclasses that know what
+    * their box geometries depend on may override this.
+    */
+   virtual bool
+   hasSameBoxGeometry(
+      const PatchDataFactory& other) const;
+
    virtual MultiblockDataTranslator *
    getMultiblockDataTranslator();
 
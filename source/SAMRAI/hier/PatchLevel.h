@@ -39,6 +39,34 @@ class BaseGridGeometry;
  * To iterate over the local patches in a patch level, use the patch
  * level iterator class (PatchLevel::Iterator).
  *
+ * By default the local patches are iterated in BoxId order.  After load
+ * balancing this order bears no spatial relation, so consecutive
+ * patches touch unrelated memory.  With space-filling curve ordering
+ * (see setSpaceFillingCurveOrdering()), the local patches of each block
+ * are iterated along a Morton curve through their box centers, so
+ * neighboring patches are processed consecutively.  Refine and coarsen
+ * schedules order their local copies the same way.
+ *
+ * By default each patch data array is a separate allocation.  With
+ * contiguous patch data (see setContiguousPatchData()), the arrays
+ * allocated by one call of allocatePatchData() on the level share one
+ * block of memory (a tbox::StorageArena), laid out in patch iteration
+ * order, so sweeps over the level stream through memory.  The block is
+ * freed when all patch data in it have been deallocated.
+ *
+ * <b> Input Parameters </b>
+ *
+ * The following is read from the "PatchLevel" database of the input
+ * database, if it exists, when the first PatchLevel is created.
+ *
+ *    - \b space_filling_curve_ordering
+ *      Whether to iterate local patches along a space-filling curve
+ *      (bool, default FALSE).
+ *
+ *    - \b contiguous_patch_data
+ *      Whether to allocate the patch data of a level in one block
+ *      (bool, default FALSE).
+ *
  * @see BasePatchLevel
  * @see Patch
  * @see PatchDescriptor
@@ -747,22 +775,25 @@ public:
    /*!
     * @brief Allocate the specified component on all patches.
     *
+    * With contiguous patch data (see setContiguousPatchData()) the
+    * arrays of the component on the local patches are laid out in one
+    * block, in patch iteration order.
+    *
     * @param[in]  id
     * @param[in]  timestamp @b Default: zero (0.0)
     */
    void
    allocatePatchData(
       const int id,
-      const double timestamp = 0.0)
-   {
-      for (Iterator ip(begin()); ip != end(); ++ip) {
-         ip->allocatePatchData(id, timestamp);
-      }
-   }
+      const double timestamp = 0.0);
 
    /*!
     * @brief Allocate the specified components on all patches.
     *
+    * With contiguous patch data (see setContiguousPatchData()) the
+    * arrays of the components on the local patches are laid out in one
+    * block, patch by patch in patch iteration order.
+    *
     * @param[in]  components The componentSelector indicating
     *             which elements to allocate
     * @param[in]  timestamp @b Default: zero (0.0)
@@ -770,12 +801,7 @@ public:
    void
    allocatePatchData(
       const ComponentSelector& components,
-      const double timestamp = 0.0)
-   {
-      for (Iterator ip(begin()); ip != end(); ++ip) {
-         ip->allocatePatchData(components, timestamp);
-      }
-   }
+      const double timestamp = 0.0);
 
    /*!
     * @brief Determine if the patch data has been allocated.
@@ -1169,7 +1195,7 @@ public:
       const std::shared_ptr<Patch>&
       operator * () const
       {
-         return d_iterator->second;
+         return *d_iterator;
       }
 
       /*!
@@ -1178,7 +1204,7 @@ public:
       const std::shared_ptr<Patch>&
       operator -> () const
       {
-         return d_iterator->second;
+         return *d_iterator;
       }
 
       /*!
@@ -1242,12 +1268,12 @@ private:
       /*!
        * @brief The real iterator (this class is basically a wrapper).
        */
-      PatchContainer::const_iterator d_iterator;
+      PatchVector::const_iterator d_iterator;
 
       /*!
        * @brief For supporting backward-compatible interface.
        */
-      const PatchContainer* d_patches;
+      const PatchVector* d_patches;
 
    };
 
@@ -1276,6 +1302,75 @@ private:
     */
    typedef Iterator iterator;
 
+   /*!
+    * @brief Get the position of each local patch in the iteration order,
+    * keyed by the BoxId of the patch.
+    *
+    * @param[out] positions
+    */
+   void
+   getLocalPatchPositions(
+      std::map<BoxId, int>& positions) const
+   {
+      positions.clear();
+      for (size_t i = 0; i < d_patch_vector.size(); ++i) {
+         positions[d_patch_vector[i]->getBox().getBoxId()] =
+            static_cast<int>(i);
+      }
+   }
+
+   /*!
+    * @brief Set whether the local patches of PatchLevels constructed
+    * afterwards are iterated along a space-filling curve instead of in
+    * BoxId order.
+    *
+    * This overrides the input parameter space_filling_curve_ordering.
+    * The order of a PatchLevel is fixed when its patches are created.
+    */
+   static void
+   setSpaceFillingCurveOrdering(
+      bool space_filling_curve_ordering)
+   {
+      s_space_filling_curve_ordering =
+         space_filling_curve_ordering ? 'y' : 'n';
+   }
+
+   /*!
+    * @brief Return whether local patches of new PatchLevels are ordered
+    * along a space-filling curve.
+    */
+   static bool
+   getSpaceFillingCurveOrdering()
+   {
+      getFromInput();
+      return s_space_filling_curve_ordering == 'y';
+   }
+
+   /*!
+    * @brief Set whether patch data allocated on all patches of a level
+    * at once is placed in one contiguous block.
+    *
+    * This overrides the input parameter contiguous_patch_data.  It
+    * affects later calls of allocatePatchData() only.
+    */
+   static void
+   setContiguousPatchData(
+      bool contiguous_patch_data)
+   {
+      s_contiguous_patch_data = contiguous_patch_data ? 'y' : 'n';
+   }
+
+   /*!
+    * @brief Return whether patch data of a level is allocated in one
+    * contiguous block.
+    */
+   static bool
+   getContiguousPatchData()
+   {
+      getFromInput();
+      return s_contiguous_patch_data == 'y';
+   }
+
 private:
    /**
     * @brief Static initialization to be done at startup.
@@ -1296,6 +1391,20 @@ private:
    void
    initializeGlobalizedBoxLevel() const;
 
+   /*
+    * Read space_filling_curve_ordering and contiguous_patch_data from
+    * the input database, if not yet read or set.
+    */
+   static void
+   getFromInput();
+
+   /*!
+    * @brief Order d_patch_vector along a space-filling curve if
+    * space-filling curve ordering is on.
+    */
+   void
+   orderLocalPatches();
+
    /*!
     * @brief Dimension of the object
     */
@@ -1390,9 +1499,11 @@ private:
    PatchContainer d_patches;
 
    /*!
-    * @brief Vector holding the same patches in d_patches, in the same order.
+    * @brief Vector holding the same patches in d_patches, in iteration
+    * order.
     *
-    * This allows random access to the patches.
+    * This allows random access to the patches.  The order is that of
+    * d_patches unless space-filling curve ordering is on.
     */
    PatchVector d_patch_vector;
 
@@ -1408,6 +1519,18 @@ private:
     */
    static bool s_initialized;
 
+   /*!
+    * @brief Whether to order local patches along a space-filling curve:
+    * 'y' or 'n', or '\0' if the input has not been read.
+    */
+   static char s_space_filling_curve_ordering;
+
+   /*!
+    * @brief Whether to allocate the patch data of a level in one block:
+    * 'y' or 'n', or '\0' if the input has not been read.
+    */
+   static char s_contiguous_patch_data;
+
    /*!
     * @brief Initialize static state
     */
@@ -13,6 +13,7 @@
 #include "SAMRAI/SAMRAI_config.h"
 #include "SAMRAI/hier/IntVector.h"
 
+#include <iostream>
 #include <vector>
 
 namespace SAMRAI {
@@ -48,6 +49,16 @@ class BoxLevel;
  * and copied into the collection.  Connectors can also be
  * automatically computed using a non-scalable global search.
  *
+ * The Connectors of all BoxLevels may be held within a memory budget
+ * (see setMemoryBudget()).  When enforceMemoryBudget() finds the
+ * cached Connectors using more memory than the budget, it deletes the
+ * least recently used Connectors that can be regenerated locally, that
+ * is, those for which a wider Connector with the same head is also
+ * cached.  A later request for a deleted Connector is satisfied by
+ * shrinking the wider one, without communication.  Connectors without a
+ * wider one are never deleted, since regenerating them may need a
+ * global search.
+ *
  * <b> Input Parameters </b>
  *
  * <b> Definitions: </b>
@@ -59,6 +70,11 @@ class BoxLevel;
  *      look for overlaps.  If "WARN", do the same thing but write a warning to
  *      the log.  If "ERROR", exit with an error.
  *
+ *    - \b memory_budget
+ *      Memory budget, in megabytes, for the Connectors cached by all
+ *      BoxLevels on each process.  Zero means no budget.  See
+ *      setMemoryBudget().
+ *
  * <b> Details: </b> <br>
  * <table>
  *   <tr>
@@ -77,6 +93,14 @@ class BoxLevel;
  *     <td>opt</td>
  *     <td>Not read from restart</td>
  *   </tr>
+ *   <tr>
+ *     <td>memory_budget</td>
+ *     <td>double</td>
+ *     <td>0.0</td>
+ *     <td>>= 0.0</td>
+ *     <td>opt</td>
+ *     <td>Not read from restart</td>
+ *   </tr>
  * </table>
  *
  * @note Creating overlap Connectors by global search is not scalable
@@ -106,6 +130,61 @@ public:
    setCreateEmptyNeighborContainers(
       bool create_empty_neighbor_containers);
 
+   /*!
+    * @brief Set the memory budget, in bytes, for the Connectors cached
+    * by all BoxLevels on this process.
+    *
+    * Zero, the default, means no budget.  The budget is only applied
+    * by enforceMemoryBudget().
+    */
+   static void
+   setMemoryBudget(
+      size_t memory_budget)
+   {
+      s_memory_budget = memory_budget;
+   }
+
+   /*!
+    * @brief Return the memory budget set by setMemoryBudget() or the
+    * input database.
+    */
+   static size_t
+   getMemoryBudget()
+   {
+      return s_memory_budget;
+   }
+
+   /*!
+    * @brief Delete least recently used Connectors that can be
+    * regenerated locally until the cached Connectors of all BoxLevels
+    * fit in the memory budget or no such Connector remains.
+    *
+    * References to Connectors obtained from BoxLevel before this call
+    * may become invalid, so it should be called only where no such
+    * references are kept, e.g. between regrids.  GriddingAlgorithm
+    * calls it after building or regridding levels.  This method is
+    * local.
+    */
+   static void
+   enforceMemoryBudget();
+
+   /*!
+    * @brief Return the number of bytes held by the Connectors cached by
+    * all BoxLevels on this process.
+    */
+   static size_t
+   getCachedMemory();
+
+   /*!
+    * @brief Print the cache statistics of this process: lookups found
+    * in the cache, lookups satisfied by shrinking a wider Connector,
+    * lookups not found, Connectors deleted by enforceMemoryBudget() and
+    * the memory held.
+    */
+   static void
+   printStatistics(
+      std::ostream& os);
+
 private:
    /*!
     * @brief Deletes all Connectors to and from this object
@@ -342,6 +421,31 @@ private:
    postprocessForEmptyNeighborContainers(
       Connector& connector);
 
+   /*
+    * @brief Add a Connector from me to head to the collections of both
+    * BoxLevels, marking it as just used.
+    */
+   void
+   addConnector(
+      const BoxLevel& head,
+      const std::shared_ptr<Connector>& connector);
+
+   /*
+    * @brief Remove d_cons_from_me[i] from the collections of both
+    * BoxLevels.
+    */
+   void
+   removeConnector(
+      int i);
+
+   /*
+    * @brief Whether d_cons_from_me[i] can be regenerated by shrinking
+    * another cached Connector.
+    */
+   bool
+   isRegenerable(
+      int i) const;
+
    //@}
 
    //@{
@@ -359,11 +463,24 @@ private:
     */
    ConVect d_cons_from_me;
 
+   /*!
+    * @brief Access stamp of each Connector in d_cons_from_me, from
+    * s_access_count.
+    */
+   std::vector<size_t> d_last_access;
+
    /*!
     * @brief Persistent overlap Connectors incident to me.
     */
    ConVect d_cons_to_me;
 
+   /*!
+    * @brief Links in the list of all objects, used to apply the memory
+    * budget.
+    */
+   PersistentOverlapConnectors* d_prev;
+   PersistentOverlapConnectors* d_next;
+
    /*!
     * @brief Reference to the BoxLevel served by this object.
     */
@@ -398,6 +515,30 @@ private:
     */
    static size_t s_num_implicit_global_searches;
 
+   /*!
+    * @brief First object in the list of all objects.
+    */
+   static PersistentOverlapConnectors* s_first;
+
+   /*!
+    * @brief Memory budget in bytes, zero if none.
+    */
+   static size_t s_memory_budget;
+
+   /*!
+    * @brief Counter stamping Connector accesses, for LRU ordering.
+    */
+   static size_t s_access_count;
+
+   //@{
+   //! @name Cache statistics.
+   static size_t s_num_hits;
+   static size_t s_num_shrinks;
+   static size_t s_num_misses;
+   static size_t s_num_evictions;
+   static size_t s_evicted_memory;
+   //@}
+
 };
 
 }
@@ -184,6 +184,13 @@ class BergerRigoutsosNode;
  *       thickest direction.  This leads to more cubic boxes but may
  *       prevent cutting at important feature changes.
  *
+ * @internal DEV_comm_segment_size (0)
+ * int
+ * Number of integers per message in the histogram reductions, which are
+ * pipelined through the communication tree in segments of this size.
+ * Zero sends each histogram in one message.  Histograms of the root node
+ * are reduced with MPI collectives and are not affected.
+ *
  * @internal The following are developer inputs for debugging.  Defaults listed
  * in parenthesis:
  *
@@ -695,6 +702,12 @@ private:
     */
    bool d_build_zero_width_connector;
 
+   /*!
+    * @brief Segment size for pipelining histogram reductions (see
+    * tbox::AsyncCommGroup::setSegmentSize()).
+    */
+   int d_comm_segment_size;
+
    /*!
     * @brief Efficiency tolerance during clustering.
     *
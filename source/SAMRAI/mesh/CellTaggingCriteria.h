@@ -0,0 +1,372 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2017 Lawrence Livermore National Security, LLC
+ * Description:   Input-configured cell tagging criteria.
+ *
+ ************************************************************************/
+#ifndef included_mesh_CellTaggingCriteria
+#define included_mesh_CellTaggingCriteria
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/ComponentSelector.h"
+#include "SAMRAI/hier/IntVector.h"
+#include "SAMRAI/hier/Patch.h"
+#include "SAMRAI/hier/PatchHierarchy.h"
+#include "SAMRAI/pdat/CellData.h"
+#include "SAMRAI/tbox/Database.h"
+#include "SAMRAI/tbox/Timer.h"
+#include "SAMRAI/xfer/RefineAlgorithm.h"
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace SAMRAI {
+namespace mesh {
+
+/*!
+ * @brief Library of cell tagging criteria applied to cell-centered
+ * double data named in the input database.
+ *
+ * Each criterion compares an indicator computed from one component of
+ * a variable against a threshold and tags the cells where the
+ * indicator exceeds it.  The results of all criteria are combined with
+ * a logical OR (tag where any criterion fires) or AND (tag where every
+ * criterion fires) and the resulting tags are written into the tag
+ * CellData.  Cells already tagged are never untagged.
+ *
+ * The criteria read the data through a private scratch copy whose ghost
+ * cells are filled from the same level and, on finer levels, by
+ * CONSTANT_REFINE interpolation from the next coarser level.  Stencils
+ * are clamped at physical boundaries, where no ghost data is filled.
+ * The kernels work on whole rows of the patch at a time so the inner
+ * loops are free of branches and vectorize.
+ *
+ * The criteria use undivided differences, so thresholds are in the
+ * units of the data and do not depend on the mesh spacing:
+ *
+ *   - VALUE_ABOVE: u > threshold.
+ *   - VALUE_BELOW: u < threshold.
+ *   - GRADIENT: the magnitude of the undivided central difference
+ *     gradient exceeds threshold.  Next to a physical boundary the
+ *     one-sided difference is used in the normal direction.
+ *   - RELATIVE_JUMP: the largest jump to a face neighbor exceeds
+ *     threshold * |u|.
+ *   - SHOCK: the face jump exceeds threshold in a direction where the
+ *     second difference indicates a discontinuity, that is where
+ *     onset * |u(i+2) - u(i-2)| <= |u(i+1) - u(i-1)| or the two
+ *     differences have opposite signs.  This is the detector used by
+ *     the Euler example.
+ *
+ * <b> Input Parameters </b>
+ *
+ * <b> Definitions: </b>
+ *
+ *   - \b combine
+ *   How the criteria are combined, "OR" or "AND".
+ *
+ *   - \b criterion_N
+ *   Database describing criterion N, N = 0, 1, ....  The criteria must
+ *   be numbered consecutively.  Each contains:
+ *
+ *      - \b type
+ *      One of VALUE_ABOVE, VALUE_BELOW, GRADIENT, RELATIVE_JUMP, SHOCK.
+ *
+ *      - \b variable
+ *      Name of a pdat::CellVariable<double> in the hier::VariableDatabase.
+ *
+ *      - \b context
+ *      Name of the context under which the tagged data is registered.
+ *
+ *      - \b depth
+ *      Component of the variable the criterion is applied to.
+ *
+ *      - \b threshold
+ *      Threshold for each level.  The last value is used for levels
+ *      beyond the end of the array.
+ *
+ *      - \b onset
+ *      SHOCK only.  Onset ratio for each level, as for threshold.
+ *
+ * <b> Details: </b> <br>
+ * <table>
+ *   <tr>
+ *     <th>parameter</th>
+ *     <th>type</th>
+ *     <th>default</th>
+ *     <th>range</th>
+ *     <th>opt/req</th>
+ *     <th>behavior on restart</th>
+ *   </tr>
+ *   <tr>
+ *     <td>combine</td>
+ *     <td>string</td>
+ *     <td>"OR"</td>
+ *     <td>"OR", "AND"</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>type</td>
+ *     <td>string</td>
+ *     <td>none</td>
+ *     <td>see above</td>
+ *     <td>req</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>variable</td>
+ *     <td>string</td>
+ *     <td>none</td>
+ *     <td>any registered CellVariable<double></td>
+ *     <td>req</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>context</td>
+ *     <td>string</td>
+ *     <td>"CURRENT"</td>
+ *     <td>any registered context</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>depth</td>
+ *     <td>int</td>
+ *     <td>0</td>
+ *     <td>0 <= depth < variable depth</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>threshold</td>
+ *     <td>double[]</td>
+ *     <td>none</td>
+ *     <td>any double</td>
+ *     <td>req</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>onset</td>
+ *     <td>double[]</td>
+ *     <td>0.85</td>
+ *     <td>any double >= 0</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ * </table>
+ *
+ * A sample input entry, used as a tagging criterion of
+ * StandardTagAndInitialize, is:
+ *
+ * @code
+ *    tagging_method = "CELL_CRITERIA"
+ *    combine = "OR"
+ *    criterion_0 {
+ *       type = "GRADIENT"
+ *       variable = "density"
+ *       threshold = 0.1, 0.05
+ *    }
+ *    criterion_1 {
+ *       type = "SHOCK"
+ *       variable = "pressure"
+ *       threshold = 0.05
+ *       onset = 0.85
+ *    }
+ * @endcode
+ *
+ * @see StandardTagAndInitialize
+ */
+class CellTaggingCriteria
+{
+public:
+   /*!
+    * @brief Constructor.
+    *
+    * @param[in] object_name Name used in error reporting and for the
+    *                        scratch variable context.
+    * @param[in] input_db Database holding the criteria.
+    *
+    * @pre !object_name.empty()
+    * @pre input_db
+    */
+   CellTaggingCriteria(
+      const std::string& object_name,
+      const std::shared_ptr<tbox::Database>& input_db);
+
+   ~CellTaggingCriteria();
+
+   /*!
+    * @brief Tag cells of a level where the criteria fire.
+    *
+    * The scratch data is allocated, filled and released within this
+    * call.  Data on the next coarser level, if any, must be current at
+    * tag_time.
+    *
+    * @param[in] hierarchy
+    * @param[in] level_number
+    * @param[in] tag_time Simulation time of the data being tagged.
+    * @param[in] tag_index Patch data index of the CellData<int> tags.
+    *
+    * @pre hierarchy
+    * @pre hierarchy->getPatchLevel(level_number)
+    * @pre tag_index >= 0
+    */
+   void
+   tagCells(
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+      const int level_number,
+      const double tag_time,
+      const int tag_index);
+
+   /*!
+    * @brief Look up the tagged variables in the variable database.
+    *
+    * This is done automatically by the first tagCells() call.  Calling
+    * it earlier registers the scratch data before the hierarchy
+    * computes its required Connector widths.  Returns false without
+    * doing anything if some variable is not yet registered.
+    */
+   bool
+   resolveVariables();
+
+   /*!
+    * @brief Return the stencil width needed by the criteria.
+    */
+   int
+   getStencilWidth() const
+   {
+      return d_stencil_width;
+   }
+
+   /*!
+    * @brief Return the name of this object.
+    */
+   const std::string&
+   getObjectName() const
+   {
+      return d_object_name;
+   }
+
+   /*!
+    * @brief Print the criteria.
+    */
+   void
+   printClassData(
+      std::ostream& os) const;
+
+private:
+   // The following are not implemented:
+   CellTaggingCriteria(
+      const CellTaggingCriteria&);
+
+   CellTaggingCriteria&
+   operator = (
+      const CellTaggingCriteria&);
+
+   enum CriterionType {
+      VALUE_ABOVE = 0,
+      VALUE_BELOW = 1,
+      GRADIENT = 2,
+      RELATIVE_JUMP = 3,
+      SHOCK = 4
+   };
+
+   struct Criterion {
+      CriterionType d_type;
+      std::string d_variable_name;
+      std::string d_context_name;
+      int d_depth;
+      std::vector<double> d_threshold;
+      std::vector<double> d_onset;
+      int d_src_id;
+      int d_scratch_id;
+   };
+
+   /*
+    * Apply the criteria to one patch, writing tags into tag_data.
+    */
+   void
+   tagPatch(
+      const hier::Patch& patch,
+      pdat::CellData<int>& tag_data,
+      const int level_number);
+
+   /*
+    * Evaluate one criterion along a row of cells and set hit[i] to 1
+    * where it fires.  center points to the row, padded by the stencil
+    * width at each end, and minus/plus hold the rows offset by 1 and 2
+    * cells in each direction other than 0.  end_scale holds the
+    * reciprocal of the index distance spanned by the GRADIENT difference
+    * at the first and last cells of the row and scale[a] the one spanned
+    * by the rows minus[a][0] and plus[a][0]; these are 1/2 away from
+    * physical boundaries and 1 where the stencil is clamped.  work is
+    * scratch space for ncells values.
+    */
+   static void
+   evaluateRow(
+      const Criterion& criterion,
+      const double threshold,
+      const double onset,
+      const int ncells,
+      const int dim,
+      const double* center,
+      const double* const minus[][2],
+      const double* const plus[][2],
+      const double end_scale[2],
+      const double scale[],
+      int* hit,
+      double* work);
+
+   static const char*
+   getTypeName(
+      CriterionType type);
+
+   /*
+    * Read the criteria from input.
+    */
+   void
+   getFromInput(
+      const std::shared_ptr<tbox::Database>& input_db);
+
+   std::string d_object_name;
+
+   std::vector<Criterion> d_criteria;
+
+   /*
+    * True to combine the criteria with AND, false for OR.
+    */
+   bool d_combine_and;
+
+   /*
+    * Ghost width of the scratch data, the widest criterion stencil.
+    */
+   int d_stencil_width;
+
+   bool d_variables_resolved;
+
+   hier::ComponentSelector d_scratch_data;
+
+   std::shared_ptr<xfer::RefineAlgorithm> d_fill_alg;
+
+   /*
+    * Row work space, reused across patches.
+    */
+   std::vector<double> d_center_row;
+   std::vector<int> d_hit_row;
+   std::vector<double> d_work_row;
+   std::vector<int> d_combined_row;
+
+   std::shared_ptr<tbox::Timer> t_tag_cells;
+   std::shared_ptr<tbox::Timer> t_fill_ghosts;
+};
+
+}
+}
+
+#endif
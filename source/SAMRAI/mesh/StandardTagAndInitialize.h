@@ -12,6 +12,7 @@
 #define included_mesh_StandardTagAndInitialize
 
 #include "SAMRAI/SAMRAI_config.h"
+#include "SAMRAI/mesh/CellTaggingCriteria.h"
 #include "SAMRAI/mesh/StandardTagAndInitStrategy.h"
 #include "SAMRAI/mesh/StandardTagAndInitializeConnectorWidthRequestor.h"
 #include "SAMRAI/mesh/TagAndInitializeStrategy.h"
@@ -34,13 +35,14 @@ namespace mesh {
  *   - Gradient Detection
  *   - Richardson Extrapolation
  *   - Explicitly defined refine boxes
+ *   - Built-in cell criteria on named variables (see CellTaggingCriteria)
  *
  * Tagging methods may be activated at specific cycles and/or times.
  * It is possible to use combinations of these three methods (e.g.,
  * use gradient detection, Richardson extrapolation, and static refine boxes
  * at the same cycle/time).  The order in which they are executed is fixed
- * (Richardson extrapolation first, gradient detection second, and refine
- * boxes third).  An input entry for this class is optional.
+ * (Richardson extrapolation first, gradient detection second, built-in
+ * cell criteria third and refine boxes last).  An input entry for this class is optional.
  * If none is provided, the class will, by default, not use any criteria
  * to tag cells for refinement and issue a warning.
  *
@@ -61,7 +63,12 @@ namespace mesh {
  *         - \b tag_0
  *           first tagging method in this set of tagging methods
  *              - \b tagging_method = one of RICHARDSON_EXTRAPOLATION,
- *                                    GRADIENT_DETECTOR, REFINE_BOXES, NONE
+ *                                    GRADIENT_DETECTOR, CELL_CRITERIA,
+ *                                    REFINE_BOXES, NONE
+ *              - \b combine, \b criterion_0, ...
+ *                required if tagging_method is CELL_CRITERIA, the criteria
+ *                applied by the library instead of by the
+ *                StandardTagAndInitStrategy.  See CellTaggingCriteria.
  *              - \b level_m
  *                required if tagging_method is REFINE_BOXES, the static boxes
  *                for the mth level
@@ -88,9 +95,9 @@ namespace mesh {
  *       "level_m" database.
  *
  *       It is possible to use a "shortcut" input syntax for extremely
- *       simple tagging criteria.  If you only want RICHARDSON_EXTRAPOLATION
- *       or GRADIENT_DETECTOR on for the entire simulation then an input
- *       of the following form may be used:
+ *       simple tagging criteria.  If you only want RICHARDSON_EXTRAPOLATION,
+ *       GRADIENT_DETECTOR or CELL_CRITERIA on for the entire simulation then
+ *       an input of the following form may be used:
  *
  * @code
  *    tagging_method = RICHARDSON_EXTRAPOLATION
@@ -244,6 +251,23 @@ public:
       int cycle,
       double time);
 
+   /*!
+    * Returns true if built-in cell criteria are used at any cycle or time.
+    */
+   bool
+   everUsesCellCriteria() const;
+
+   /*!
+    * Returns true if built-in cell criteria are used at the supplied cycle
+    * and time.
+    *
+    * @pre !d_use_cycle_criteria || !d_use_time_criteria
+    */
+   bool
+   usesCellCriteria(
+      int cycle,
+      double time);
+
    /*!
     * Returns true if user supplied refine boxes is used at any cycle or time.
     */
@@ -346,7 +370,8 @@ public:
    /*!
     * Pass the request to set tags on the given level where refinement of
     * that level should occur.  Gradient detection, Richardson extrapolation,
-    * and tagging on static refine boxes is performed here.
+    * built-in cell criteria and tagging on static refine boxes is performed
+    * here.
     *
     * For more information on the operations that must be performed, see the
     * TagAndInitializeStrategy::tagCellsForRefinement() routine.
@@ -658,6 +683,7 @@ private:
    struct TagCriteria {
       std::string d_tagging_method;
       std::map<int, hier::BoxContainer> d_level_refine_boxes;
+      std::shared_ptr<CellTaggingCriteria> d_cell_criteria;
    };
 
    struct CycleTagCriteria {
@@ -734,6 +760,11 @@ private:
     */
    bool d_ever_uses_gradient_detector;
 
+   /*
+    * Flag indicating if any tagging criteria is CELL_CRITERIA.
+    */
+   bool d_ever_uses_cell_criteria;
+
    /*
     * Flag indicating if any tagging criteria is REFINE_BOXES.
     */
@@ -22,7 +22,9 @@
 #include "SAMRAI/tbox/Database.h"
 #include "SAMRAI/tbox/MemoryUtilities.h"
 #include "SAMRAI/tbox/MessageStream.h"
+#include "SAMRAI/tbox/StorageArena.h"
 
+#include <memory>
 #include <typeinfo>
 #include <vector>
 
@@ -52,6 +54,12 @@ class SideData;
  * float, and int).  To use this class with other user-defined types,
  * many of these functions will need to be specialized, especially those
  * that deal with message packing and unpacking.
+ *
+ * If a tbox::StorageArena is active when the array is constructed and
+ * TYPE is trivially destructible, the storage is taken from the arena
+ * (value-initialized as otherwise) so that arrays allocated together lie
+ * contiguously in memory.  The array keeps the arena alive.  When the
+ * arena is exhausted the array allocates its own storage.
  */
 
 template<class TYPE>
@@ -652,7 +660,7 @@ private:
       const hier::Box& box);
 
    /*!
-    * @brief Compte index into d_array for data at index i and depth d.
+    * @brief Compte index into d_data for data at index i and depth d.
     *
     * @param i Index of data
     * @param d depth of data
@@ -666,10 +674,24 @@ private:
       const hier::Index& i,
       unsigned int d) const;
 
+   /*
+    * Set d_data to storage for d_depth * d_offset values, from the active
+    * tbox::StorageArena if possible and otherwise from d_array.
+    */
+   void
+   allocateStorage();
+
    unsigned int d_depth;
    size_t d_offset;
    hier::Box d_box;
+
+   /*
+    * The values.  d_data points into d_array, or into d_arena when the
+    * storage was taken from an arena.
+    */
    std::vector<TYPE> d_array;
+   TYPE* d_data;
+   std::shared_ptr<tbox::StorageArena> d_arena;
 };
 
 }
@@ -91,7 +91,13 @@ public:
     * Pre-increment the iterator to point to the next index in the box.
     */
    CellIterator&
-   operator ++ ();
+   operator ++ ()
+   {
+      if (++d_index(0) > d_box.upper(0)) {
+         carry();
+      }
+      return *this;
+   }
 
    /**
     * Post-increment the iterator to point to the next index in the box.
@@ -143,6 +149,13 @@ private:
    // Unimplemented default constructor.
    CellIterator();
 
+   /*
+    * Move the index to the start of the next row after direction 0
+    * passed its upper bound.
+    */
+   void
+   carry();
+
    CellIndex d_index;
    hier::Box d_box;
 };
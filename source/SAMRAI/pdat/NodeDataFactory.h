@@ -141,6 +141,14 @@ public:
    validCopyTo(
       const std::shared_ptr<hier::PatchDataFactory>& dst_pdf) const;
 
+   /**
+    * Return whether other is exactly a NodeDataFactory of the same type
+    * with the same ghost cell width.
+    */
+   bool
+   hasSameBoxGeometry(
+      const hier::PatchDataFactory& other) const;
+
 private:
    int d_depth;
    bool d_fine_boundary_represents_var;
@@ -148,6 +148,14 @@ public:
    validCopyTo(
       const std::shared_ptr<hier::PatchDataFactory>& dst_pdf) const;
 
+   /**
+    * Return whether other is exactly a OuteredgeDataFactory of the same type
+    * with the same ghost cell width.
+    */
+   bool
+   hasSameBoxGeometry(
+      const hier::PatchDataFactory& other) const;
+
 private:
    int d_depth;
    hier::IntVector d_no_ghosts;
@@ -91,7 +91,13 @@ public:
     * Pre-increment the iterator to point to the next index in the box.
     */
    SideIterator&
-   operator ++ ();
+   operator ++ ()
+   {
+      if (++d_index(0) > d_box.upper(0)) {
+         carry();
+      }
+      return *this;
+   }
 
    /**
     * Post-increment the iterator to point to the next index in the box.
@@ -146,6 +152,13 @@ private:
    // Unimplemented default constructor.
    SideIterator();
 
+   /*
+    * Move the index to the start of the next row after direction 0
+    * passed its upper bound.
+    */
+   void
+   carry();
+
    SideIndex d_index;
    hier::Box d_box;
 };
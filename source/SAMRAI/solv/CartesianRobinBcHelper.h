@@ -22,6 +22,7 @@
 #include "SAMRAI/hier/Patch.h"
 #include "SAMRAI/tbox/Utilities.h"
 
+#include <map>
 #include <memory>
 
 namespace SAMRAI {
@@ -42,6 +43,11 @@ namespace solv {
  * of the Robin formula.  This class currently supports cell-centered
  * alignment and will support node-centered alignment in the future.
  *
+ * Data with several depths is treated as independent scalar
+ * quantities sharing the a and b coefficients.  The g coefficient
+ * array given to the RobinBcCoefStrategy has the depth of the data,
+ * so each depth may have its own g.
+ *
  * See RobinBcCoefStrategy for the description of the Robin
  * boundary condition.
  *
@@ -312,6 +318,9 @@ public:
       if (!coef_strategy) {
          TBOX_ERROR(d_object_name << ": Invalid pointer value" << std::endl);
       }
+      if (coef_strategy != d_coef_strategy) {
+         clearCoefCache();
+      }
       d_coef_strategy = coef_strategy;
    }
 
@@ -351,6 +360,24 @@ public:
 
    //@}
 
+   /*!
+    * @brief Discard the cached boundary condition coefficients.
+    *
+    * For coefficient strategies that allow it (see
+    * RobinBcCoefStrategy::areCoefsCacheable()), the coefficients are
+    * kept for each patch boundary box and variable and reused until
+    * the strategy reports a change or, for time-dependent coefficients,
+    * the fill time changes.  The coefficient arrays are reused for all
+    * strategies.  Entries are checked against the patch box, so stale
+    * entries are never used, but they use memory; call this after the
+    * levels the helper is used on change, such as after regridding.
+    */
+   void
+   clearCoefCache()
+   {
+      d_coef_cache.clear();
+   }
+
    /*!
     * @brief Get the name of this object.
     *
@@ -440,6 +467,86 @@ private:
    makeFaceBoundaryBox(
       const hier::BoundaryBox& boundary_box) const;
 
+   /*!
+    * @brief Key of a cached set of coefficients: the patch, the
+    * position of the boundary box in the patch's codimension 1
+    * boundary boxes and the variable.
+    */
+   struct CoefCacheKey {
+      CoefCacheKey(
+         const hier::BoxId& box_id,
+         int level_number,
+         int bdry_box_number,
+         int variable_id):
+         d_box_id(box_id),
+         d_level_number(level_number),
+         d_bdry_box_number(bdry_box_number),
+         d_variable_id(variable_id)
+      {
+      }
+
+      bool
+      operator < (
+         const CoefCacheKey& other) const;
+
+      hier::BoxId d_box_id;
+      int d_level_number;
+      int d_bdry_box_number;
+      int d_variable_id;
+   };
+
+   /*!
+    * @brief Coefficient arrays for a boundary box and what they were
+    * computed for.
+    *
+    * The arrays are reused whenever the coefficient box is unchanged.
+    * The values are reused only if d_valid is set and the patch box,
+    * ratio, location index, strategy version and (for time-dependent
+    * coefficients) fill time are unchanged.
+    */
+   struct CoefCacheEntry {
+      explicit CoefCacheEntry(
+         const tbox::Dimension& dim):
+         d_patch_box(dim),
+         d_ratio(dim),
+         d_location_index(-1),
+         d_fill_time(0.0),
+         d_version(0),
+         d_valid(false),
+         d_g_valid(false)
+      {
+      }
+
+      std::shared_ptr<pdat::ArrayData<double> > d_acoef;
+      std::shared_ptr<pdat::ArrayData<double> > d_bcoef;
+      std::shared_ptr<pdat::ArrayData<double> > d_gcoef;
+      hier::Box d_patch_box;
+      hier::IntVector d_ratio;
+      int d_location_index;
+      double d_fill_time;
+      int d_version;
+      bool d_valid;
+      bool d_g_valid;
+   };
+
+   /*!
+    * @brief Return the coefficients for a boundary box of a patch,
+    * calling RobinBcCoefStrategy::setBcCoefs() only if the cached
+    * coefficients cannot be reused.
+    *
+    * The g coefficient array is set only if homogeneous_bc is false.
+    * It has the given depth, that of the data being filled.
+    */
+   const CoefCacheEntry&
+   getCoefs(
+      const hier::Patch& patch,
+      int bdry_box_number,
+      const hier::BoundaryBox& boundary_box,
+      const std::shared_ptr<hier::Variable>& variable,
+      double fill_time,
+      bool homogeneous_bc,
+      int depth) const;
+
    std::string d_object_name;
 
    const tbox::Dimension d_dim;
@@ -460,6 +567,11 @@ private:
     */
    bool d_homogeneous_bc;
 
+   /*!
+    * @brief Cached coefficients, see clearCoefCache().
+    */
+   mutable std::map<CoefCacheKey, CoefCacheEntry> d_coef_cache;
+
    /*!
     * @brief Timers for performance measurement.
     */
@@ -47,6 +47,7 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace SAMRAI {
 namespace solv {
@@ -75,7 +76,7 @@ namespace solv {
  * This class provides:
  * -# 5-point (second order), cell-centered stencil operations
  *    for the discrete Laplacian.
- * -# Red-black Gauss-Seidel smoothing.
+ * -# Red-black Gauss-Seidel or Chebyshev polynomial smoothing.
  * -# Provisions for working Robin boundary conditions
  *    (see RobinBcCoefStrategy).
  *
@@ -86,9 +87,13 @@ namespace solv {
  *    with appropriate norm weighting for the cell-centered AMR mesh.
  *    This class provides the function computeVectorWeights()
  *    to help with computing the appropriate weights.
- *    Since this is for a scalar equation, only the first depth
- *    of the first component of the vectors are used.
- *    All other parts are ignored.
+ *    Only the first component of the vectors is used.
+ *    If it has several depths, each depth is an independent
+ *    right-hand side of the same equation, and all are solved
+ *    together: every ghost fill, restriction and prolongation
+ *    transfers all depths at once and the patch kernels loop over
+ *    them, so the communication latency is shared by the batch.
+ *    The residual norm and the convergence test cover all depths.
  * -# The source vector SAMRAIVectorReal for f.
  * -# A PoissonSpecifications objects to specify
  *    the cell-centered scalar field C and the side-centered
@@ -118,6 +123,22 @@ namespace solv {
  *
  *    - \b    enable_logging
  *
+ *    - \b    smoothing_choice
+ *       Error smoother: "redblack" (red-black Gauss-Seidel) or
+ *       "chebyshev" (Jacobi-preconditioned Chebyshev polynomial, whose
+ *       degree is the number of sweeps).  The Chebyshev smoother needs one
+ *       ghost fill per degree and no global reductions; the largest
+ *       eigenvalue it targets is estimated by power iterations on each
+ *       level in initializeOperatorState().  The coarse level solvers
+ *       "redblack" and "jacobi" always use red-black Gauss-Seidel.
+ *
+ *    - \b    chebyshev_eigenvalue_ratio
+ *       Ratio of the smallest to the largest eigenvalue of the range
+ *       damped by the Chebyshev smoother.
+ *
+ *    - \b    chebyshev_power_iterations
+ *       Number of power iterations estimating the largest eigenvalue.
+ *
  * <b> Details:</b> <br>
  * <table>
  *   <tr>
@@ -176,6 +197,30 @@ namespace solv {
  *     <td>opt</td>
  *     <td>Not written to restart.  Value in input db used.</td>
  *   </tr>
+ *   <tr>
+ *     <td>smoothing_choice</td>
+ *     <td>string</td>
+ *     <td>"redblack"</td>
+ *     <td>"redblack", "chebyshev"</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart.  Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>chebyshev_eigenvalue_ratio</td>
+ *     <td>double</td>
+ *     <td>0.3</td>
+ *     <td>>0.0 and <1.0</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart.  Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>chebyshev_power_iterations</td>
+ *     <td>int</td>
+ *     <td>10</td>
+ *     <td>>=1</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart.  Value in input db used.</td>
+ *   </tr>
  * </table>
  *
  */
@@ -522,6 +567,48 @@ private:
       int num_sweeps,
       double residual_tolerance = -1.0);
 
+   /*!
+    * @brief Chebyshev polynomial error smoothing on a level.
+    *
+    * Smoothes on the residual equation @f$ Ae=r @f$ on a level with
+    * the Jacobi-preconditioned Chebyshev iteration of the given degree,
+    * damping the eigenvalues of @f$ D^{-1}A @f$ between
+    * chebyshev_eigenvalue_ratio times and 1.1 times the estimate of the
+    * largest one made by computeChebyshevBounds().
+    *
+    * @param error error vector
+    * @param residual residual vector
+    * @param ln level number
+    * @param degree polynomial degree
+    *
+    * @pre data.getPatchHierarchy() == d_hierarchy &&
+    *      residual.getPatchHierarchy() == d_hierarchy
+    */
+   void
+   smoothErrorByChebyshev(
+      SAMRAIVectorReal<double>& error,
+      const SAMRAIVectorReal<double>& residual,
+      int ln,
+      int degree);
+
+   /*!
+    * @brief Compute the inverse diagonal of the operator on a level and
+    * estimate the largest eigenvalue of the Jacobi-preconditioned
+    * operator by power iterations.
+    *
+    * The inverse diagonal is stored in the Chebyshev diagonal scratch
+    * data, which must be allocated on the level, and the estimate in
+    * d_chebyshev_lambda_max[ln].
+    *
+    * @param work allocated vector like the solution, used for the
+    *        power iterations
+    * @param ln level number
+    */
+   void
+   computeChebyshevBounds(
+      SAMRAIVectorReal<double>& work,
+      int ln);
+
    /*!
     * @brief Solve the coarsest level using HYPRE
     */
@@ -605,6 +692,53 @@ private:
       char red_or_black,
       double* p_maxres = 0) const;
 
+   /*!
+    * @brief AMR-unaware function to compute the inverse of the diagonal
+    * of the discrete operator on a single patch.
+    *
+    * Boundary and coarse-fine modifications of the diagonal are
+    * neglected.
+    *
+    * @param patch patch
+    * @param dinv_data cell-centered inverse diagonal output
+    */
+   void
+   computeDiagonalInverseOnPatch(
+      const hier::Patch& patch,
+      pdat::CellData<double>& dinv_data) const;
+
+   /*!
+    * @brief AMR-unaware function to perform one Chebyshev update on a
+    * single patch.
+    *
+    * Computes the residual @f$ r = f - Au @f$ from the flux, then sets
+    * direction = direction_factor * direction
+    *           + residual_factor * dinv * r
+    * and, if update_solution is true, adds the direction to the solution.
+    *
+    * @param patch patch
+    * @param flux_data side-centered flux of the solution
+    * @param rhs_data cell-centered rhs data, or 0 for a zero rhs
+    * @param dinv_data cell-centered inverse diagonal
+    * @param soln_data cell-centered solution data
+    * @param direction_data cell-centered direction data; not read if
+    *        direction_factor is zero
+    * @param direction_factor
+    * @param residual_factor
+    * @param update_solution
+    */
+   void
+   chebyshevUpdateOnPatch(
+      const hier::Patch& patch,
+      const pdat::SideData<double>& flux_data,
+      const pdat::CellData<double>* rhs_data,
+      const pdat::CellData<double>& dinv_data,
+      pdat::CellData<double>& soln_data,
+      pdat::CellData<double>& direction_data,
+      double direction_factor,
+      double residual_factor,
+      bool update_solution) const;
+
    //@}
 
    //@{ @name For executing, caching and resetting communication schedules.
@@ -765,6 +899,16 @@ private:
    int
    registerOfluxScratch() const;
 
+   /*!
+    * @brief Make the scratch data indices refer to data of the given
+    * depth, the number of right-hand sides solved together.
+    *
+    * @pre depth > 0
+    */
+   void
+   setScratchDepth(
+      int depth);
+
    //! @brief Free static variables at shutdown time.
    static void
    finalizeCallback();
@@ -877,6 +1021,28 @@ private:
     */
    double d_residual_tolerance_during_smoothing;
 
+   /*!
+    * @brief Error smoother, "redblack" or "chebyshev".
+    */
+   std::string d_smoothing_choice;
+
+   /*!
+    * @brief Ratio of the smallest to the largest eigenvalue damped by
+    * the Chebyshev smoother.
+    */
+   double d_chebyshev_eigenvalue_ratio;
+
+   /*!
+    * @brief Number of power iterations estimating the largest eigenvalue.
+    */
+   int d_chebyshev_power_iterations;
+
+   /*!
+    * @brief Estimate of the largest eigenvalue of the Jacobi-preconditioned
+    * operator on each level, set in initializeOperatorState().
+    */
+   std::vector<double> d_chebyshev_lambda_max;
+
    /*!
     * @brief Id of the flux.
     *
@@ -914,6 +1080,12 @@ private:
    static std::shared_ptr<pdat::OutersideVariable<double> >
    s_oflux_scratch_var[SAMRAI::MAX_DIM_VAL];
 
+   static std::shared_ptr<pdat::CellVariable<double> >
+   s_cheb_dinv_scratch_var[SAMRAI::MAX_DIM_VAL];
+
+   static std::shared_ptr<pdat::CellVariable<double> >
+   s_cheb_direction_scratch_var[SAMRAI::MAX_DIM_VAL];
+
    /*!
     * @brief Default context of internally maintained hierarchy data.
     */
@@ -922,7 +1094,7 @@ private:
    /*!
     * @brief ID of the solution-like scratch data.
     *
-    * Set in constructor and never changed.
+    * Set in constructor and changed only by setScratchDepth().
     * Corresponds to a pdat::CellVariable<double> named
     * @c d_object_name+"::cell_scratch".
     * Scratch data is allocated and removed as needed
@@ -933,7 +1105,7 @@ private:
    /*!
     * @brief ID of the side-centered scratch data.
     *
-    * Set in constructor and never changed.
+    * Set in constructor and changed only by setScratchDepth().
     * Corresponds to a pdat::SideVariable<double> named
     * @c d_object_name+"::flux_scratch".
     *
@@ -945,12 +1117,43 @@ private:
    /*!
     * @brief ID of the outerside-centered scratch data.
     *
-    * Set in constructor and never changed.
+    * Set in constructor and changed only by setScratchDepth().
     * Corresponds to a pdat::OutersideVariable<double> named
     * @c d_object_name+"::oflux_scratch".
     */
    int d_oflux_scratch_id;
 
+   /*!
+    * @brief ID of the inverse diagonal used by the Chebyshev smoother.
+    *
+    * Set in constructor and never changed.
+    * Corresponds to a pdat::CellVariable<double> named
+    * @c CellPoissonFACOps::private_cheb_dinv_scratch.
+    * Allocated between initializeOperatorState() and
+    * deallocateOperatorState() when the Chebyshev smoother is used.
+    */
+   int d_cheb_dinv_scratch_id;
+
+   /*!
+    * @brief ID of the update direction of the Chebyshev smoother.
+    *
+    * Set in constructor and changed only by setScratchDepth().
+    * Corresponds to a pdat::CellVariable<double> named
+    * @c CellPoissonFACOps::private_cheb_direction_scratch.
+    * Allocated only during smoothing and eigenvalue estimation.
+    */
+   int d_cheb_direction_scratch_id;
+
+   /*!
+    * @brief Depth of the data referred to by the cell, flux, outerflux
+    * and Chebyshev direction scratch indices.
+    *
+    * It is the depth of the solution in the last call to
+    * initializeOperatorState().  The inverse diagonal of the Chebyshev
+    * smoother is shared by all depths and always has depth one.
+    */
+   int d_scratch_depth;
+
    //@}
 
    //@{
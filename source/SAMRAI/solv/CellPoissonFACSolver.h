@@ -36,6 +36,15 @@ namespace solv {
  * Boundary conditions supported are Dirichlet, Neumann and mixed
  * (Dirichlet on some faces and Neumann on others).
  *
+ * u and f may have several depths, each depth being an independent
+ * right-hand side of the same equation.  All depths are solved
+ * together, sharing D, C and the types of boundary conditions, so
+ * each ghost fill and level transfer of the FAC cycle moves the whole
+ * batch in one communication step.  Dirichlet boundary values are
+ * taken from the ghost cells of each depth of u; a user boundary
+ * condition object must fill every depth of the coefficient g.  The
+ * residual norm and the convergence test cover all depths together.
+ *
  * This class is a wrapper, providing a single class that coordinates
  * three major components: the FAC solver, the cell-centered Poisson
  * FAC operator and a default Robin bc coefficient implelemtation.
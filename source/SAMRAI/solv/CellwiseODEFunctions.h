@@ -0,0 +1,105 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2017 Lawrence Livermore National Security, LLC
+ * Description:   Interface to user functions for cellwise ODE integration
+ *
+ ************************************************************************/
+
+#ifndef included_solv_CellwiseODEFunctions
+#define included_solv_CellwiseODEFunctions
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/Patch.h"
+
+#include <cstddef>
+
+namespace SAMRAI {
+namespace solv {
+
+/**
+ * Class CellwiseODEFunctions is an abstract base class defining the
+ * interface to the user-supplied right-hand side (and, optionally,
+ * Jacobian) of a system of ODEs that is independent in each cell,
+ * such as the source terms of reaction chemistry in an operator-split
+ * scheme.  It is used by CellwiseODEIntegrator.
+ *
+ * The functions are called for a batch of cells of one patch at a time.
+ * Batch arrays are stored component-major: component i of cell c is at
+ * position i * stride + c, so loops over the cells of a batch are
+ * contiguous in memory.  Each cell is identified by its offset in the
+ * cell data being integrated (the position of the cell in the array
+ * returned by pdat::CellData::getPointer()), so other cell data on the
+ * patch with the same ghost cell width can be read at the same offsets.
+ *
+ * Cells of a batch may be at different times.  When the integrator
+ * runs on several threads the functions are called concurrently for
+ * different patches, so they must not modify shared state.
+ *
+ * @see CellwiseODEIntegrator
+ */
+
+class CellwiseODEFunctions
+{
+public:
+   /**
+    * The constructor and destructor for CellwiseODEFunctions
+    * are empty.
+    */
+   CellwiseODEFunctions();
+   virtual ~CellwiseODEFunctions();
+
+   /**
+    * User-supplied right-hand side function evaluation.
+    *
+    * The function arguments are:
+    *
+    * - \b ydot       (OUTPUT) {derivative of y in each cell}
+    * - \b y          (INPUT)  {value of the dependent variables}
+    * - \b t          (INPUT)  {time of each cell}
+    * - \b cells      (INPUT)  {offset of each cell in the cell data}
+    * - \b num_cells  (INPUT)  {number of cells in the batch}
+    * - \b stride     (INPUT)  {distance between components in the
+    *                           batch arrays}
+    * - \b patch      (INPUT)  {patch containing the cells}
+    */
+   virtual void
+   evaluateRHS(
+      double* ydot,
+      const double* y,
+      const double* t,
+      const size_t* cells,
+      int num_cells,
+      int stride,
+      hier::Patch& patch) = 0;
+
+   /**
+    * User-supplied Jacobian evaluation.
+    *
+    * Set jac[(i * n + j) * stride + c] to the derivative of component i
+    * of the right-hand side with respect to component j of y in cell c,
+    * where n is the number of components, and return true.  The other
+    * arguments are as in evaluateRHS().
+    *
+    * The default implementation returns false, in which case the
+    * integrator approximates the Jacobian by finite differences of the
+    * right-hand side.
+    */
+   virtual bool
+   evaluateJacobian(
+      double* jac,
+      const double* y,
+      const double* t,
+      const size_t* cells,
+      int num_cells,
+      int stride,
+      hier::Patch& patch);
+};
+
+}
+}
+
+#endif
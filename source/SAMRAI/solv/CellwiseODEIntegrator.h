@@ -0,0 +1,349 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2017 Lawrence Livermore National Security, LLC
+ * Description:   Batched implicit integration of independent ODEs in cells
+ *
+ ************************************************************************/
+
+#ifndef included_solv_CellwiseODEIntegrator
+#define included_solv_CellwiseODEIntegrator
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/solv/CellwiseODEFunctions.h"
+#include "SAMRAI/hier/Patch.h"
+#include "SAMRAI/hier/PatchLevel.h"
+#include "SAMRAI/tbox/Database.h"
+#include "SAMRAI/tbox/Timer.h"
+#include "SAMRAI/tbox/Utilities.h"
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace SAMRAI {
+namespace solv {
+
+/**
+ * Class CellwiseODEIntegrator advances a small stiff system of ODEs
+ * independently in every cell of a patch or level, such as the
+ * chemistry source terms of an operator-split scheme.  The unknowns
+ * are the components of a cell-centered double patch data; the
+ * right-hand side is supplied by a CellwiseODEFunctions object.
+ *
+ * Each cell takes its own adaptive steps with the second-order
+ * L-stable Rosenbrock method ROS2, whose first stage gives an embedded
+ * first-order solution for error control.  Each step factors the
+ * matrix I - gamma*h*J of the cell by LU decomposition without
+ * pivoting; a vanishing pivot rejects the step and retries it with a
+ * smaller step size.  The time derivative of the right-hand side is
+ * neglected.
+ *
+ * Cells are processed in batches.  All work arrays of a batch,
+ * including the matrices, are stored component-major so that the
+ * innermost loops run over the cells of the batch and vectorize.  A
+ * cell leaves its batch when it reaches the end time and is replaced
+ * by the next cell of the patch, so batches stay full however
+ * different the step counts of the cells are.  Patches of a level are
+ * integrated in parallel when OpenMP is enabled.
+ *
+ * The cost of a cell is proportional to its number of attempted steps.
+ * If a workload data id is set (see setWorkloadDataId()), the number of
+ * attempted steps of each cell is written to that data, which can be
+ * given to a load balancer (e.g., mesh::CascadePartitioner::
+ * setWorkloadPatchDataIndex()) to balance the cost of the integration.
+ *
+ * Input parameters (all optional):
+ *
+ *   - \b relative_tolerance
+ *      relative error tolerance (default 1e-6).
+ *
+ *   - \b absolute_tolerance
+ *      absolute error tolerance, positive (default 1e-10).
+ *
+ *   - \b initial_step_size
+ *      first step size tried in each cell; zero or less chooses it
+ *      from the right-hand side (default 0).
+ *
+ *   - \b max_steps
+ *      maximum number of attempted steps in a cell before the
+ *      integration is aborted with an error (default 10000).
+ *
+ *   - \b batch_size
+ *      number of cells integrated together (default 128).
+ *
+ * A sample input database entry:
+ *
+ * @code
+ *    relative_tolerance = 1.0e-5
+ *    absolute_tolerance = 1.0e-12
+ *    batch_size = 256
+ * @endcode
+ *
+ * @see CellwiseODEFunctions
+ */
+
+class CellwiseODEIntegrator
+{
+public:
+   /**
+    * Constructor.
+    *
+    * @param object_name
+    * @param functions  Right-hand side of the ODEs.
+    * @param input_db   Input database, may be null.
+    *
+    * @pre functions != 0
+    */
+   CellwiseODEIntegrator(
+      const std::string& object_name,
+      CellwiseODEFunctions* functions,
+      const std::shared_ptr<tbox::Database>& input_db =
+         std::shared_ptr<tbox::Database>());
+
+   /**
+    * Destructor.
+    */
+   ~CellwiseODEIntegrator();
+
+   /**
+    * Advance the ODEs in every cell of every local patch of a level
+    * from t_start to t_end.
+    *
+    * @param level
+    * @param data_id  Cell-centered double data holding the unknowns,
+    *                 one component per unknown.
+    * @param t_start
+    * @param t_end
+    *
+    * @pre t_end > t_start
+    */
+   void
+   integrate(
+      hier::PatchLevel& level,
+      int data_id,
+      double t_start,
+      double t_end);
+
+   /**
+    * Advance the ODEs in every cell of a patch from t_start to t_end.
+    *
+    * @param patch
+    * @param data_id  Cell-centered double data holding the unknowns,
+    *                 one component per unknown.
+    * @param t_start
+    * @param t_end
+    *
+    * @pre t_end > t_start
+    */
+   void
+   integrate(
+      hier::Patch& patch,
+      int data_id,
+      double t_start,
+      double t_end);
+
+   /**
+    * Set the cell-centered double data (depth 1) to receive the
+    * number of steps attempted in each cell.  A negative id, the
+    * default, disables the workload output.
+    */
+   void
+   setWorkloadDataId(
+      int workload_data_id)
+   {
+      d_workload_data_id = workload_data_id;
+   }
+
+   /**
+    * Set the relative error tolerance.
+    *
+    * @pre rtol >= 0.0
+    */
+   void
+   setRelativeTolerance(
+      double rtol)
+   {
+      TBOX_ASSERT(rtol >= 0.0);
+      d_relative_tolerance = rtol;
+   }
+
+   /**
+    * Set the absolute error tolerance.
+    *
+    * @pre atol > 0.0
+    */
+   void
+   setAbsoluteTolerance(
+      double atol)
+   {
+      TBOX_ASSERT(atol > 0.0);
+      d_absolute_tolerance = atol;
+   }
+
+   /**
+    * Set the first step size tried in each cell.  Zero or less
+    * chooses it from the right-hand side.
+    */
+   void
+   setInitialStepSize(
+      double h)
+   {
+      d_initial_step_size = h;
+   }
+
+   /**
+    * Set the maximum number of attempted steps in a cell.
+    *
+    * @pre max_steps > 0
+    */
+   void
+   setMaxSteps(
+      int max_steps)
+   {
+      TBOX_ASSERT(max_steps > 0);
+      d_max_steps = max_steps;
+   }
+
+   /**
+    * Set the number of cells integrated together.
+    *
+    * @pre batch_size > 0
+    */
+   void
+   setBatchSize(
+      int batch_size)
+   {
+      TBOX_ASSERT(batch_size > 0);
+      d_batch_size = batch_size;
+   }
+
+   /**
+    * Return the number of accepted steps, summed over the cells, of
+    * the last call to integrate() on this process.
+    */
+   long
+   getNumberOfSteps() const
+   {
+      return d_num_steps;
+   }
+
+   /**
+    * Return the number of rejected steps, summed over the cells, of
+    * the last call to integrate() on this process.
+    */
+   long
+   getNumberOfRejectedSteps() const
+   {
+      return d_num_rejected_steps;
+   }
+
+   /**
+    * Return the number of right-hand side evaluations, counted per
+    * cell, of the last call to integrate() on this process.
+    */
+   long
+   getNumberOfRHSEvaluations() const
+   {
+      return d_num_rhs_evaluations;
+   }
+
+   /**
+    * Return the largest number of steps attempted in a cell in the
+    * last call to integrate() on this process.
+    */
+   int
+   getMaxStepsInCell() const
+   {
+      return d_max_steps_in_cell;
+   }
+
+   /**
+    * Return the name of this object.
+    */
+   const std::string&
+   getObjectName() const
+   {
+      return d_object_name;
+   }
+
+   /**
+    * Print out all members of the class instance to given output
+    * stream.
+    */
+   void
+   printClassData(
+      std::ostream& os) const;
+
+private:
+   /*
+    * Integration statistics of a patch.
+    */
+   struct Statistics {
+      Statistics():
+         d_num_steps(0),
+         d_num_rejected_steps(0),
+         d_num_rhs_evaluations(0),
+         d_max_steps_in_cell(0)
+      {
+      }
+      long d_num_steps;
+      long d_num_rejected_steps;
+      long d_num_rhs_evaluations;
+      int d_max_steps_in_cell;
+   };
+
+   /*
+    * Integrate the cells of a patch, adding to the statistics.
+    */
+   void
+   integratePatch(
+      hier::Patch& patch,
+      int data_id,
+      double t_start,
+      double t_end,
+      Statistics& stats);
+
+   void
+   getFromInput(
+      const std::shared_ptr<tbox::Database>& input_db);
+
+   /*
+    * Unimplemented copy constructor and assignment.
+    */
+   CellwiseODEIntegrator(
+      const CellwiseODEIntegrator&);
+   CellwiseODEIntegrator&
+   operator = (
+      const CellwiseODEIntegrator&);
+
+   std::string d_object_name;
+
+   CellwiseODEFunctions* d_functions;
+
+   int d_workload_data_id;
+
+   double d_relative_tolerance;
+   double d_absolute_tolerance;
+   double d_initial_step_size;
+   int d_max_steps;
+   int d_batch_size;
+
+   /*
+    * Statistics of the last call to integrate().
+    */
+   long d_num_steps;
+   long d_num_rejected_steps;
+   long d_num_rhs_evaluations;
+   int d_max_steps_in_cell;
+
+   std::shared_ptr<tbox::Timer> t_integrate;
+};
+
+}
+}
+
+#endif
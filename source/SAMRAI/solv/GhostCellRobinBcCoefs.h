@@ -126,7 +126,8 @@ public:
     * ghost cell values.
     *
     * The index must correspond to cell-centered double
-    * data with the given ghost width.
+    * data with the given ghost width, and with at least the
+    * depth of the data whose boundary values are set.
     *
     * @param ghost_data_id patch data index of ghost data
     * @param extensions_fillable the number of extensions past
@@ -586,6 +586,117 @@ public:
       d_KINSOL_needs_initialization = true;
    }
 
+   /**
+    * Set the number of consecutive calls to solve() that may reuse the
+    * preconditioner set up in an earlier call instead of setting it up
+    * at the start of the solve.  Within a solve, KINSOL sets up the
+    * preconditioner every MaxStepsWithNoPrecondSetup nonlinear
+    * iterations and when its residual monitoring detects insufficient
+    * progress, as before.
+    *
+    * Reuse stops, and the next solve sets up the preconditioner, when
+    *
+    * - max_solves solves have reused it,
+    * - a solve failed,
+    * - a solve took more than the degradation factor (see
+    *   setPrecondDegradationFactor()) times the nonlinear iterations of
+    *   the last solve that started with a fresh preconditioner, or
+    * - resetPreconditioner() was called, e.g., because the time step
+    *   or the mesh changed.
+    *
+    * The default, 0, sets up the preconditioner at the start of every
+    * solve.  Setting no initial setup (setNoInitialSetup()) overrides
+    * this.
+    *
+    * @pre max_solves >= 0
+    */
+   void
+   setMaxSolvesReusingPrecond(
+      const int max_solves)
+   {
+      TBOX_ASSERT(max_solves >= 0);
+      d_max_solves_reusing_precond = max_solves;
+   }
+
+   /**
+    * Set the factor by which the number of nonlinear iterations of a
+    * solve reusing an earlier preconditioner may exceed that of the
+    * last solve starting with a fresh one before the next solve sets
+    * up the preconditioner again.  Default is 1.5.
+    *
+    * @pre factor >= 1.0
+    */
+   void
+   setPrecondDegradationFactor(
+      const double factor)
+   {
+      TBOX_ASSERT(factor >= 1.0);
+      d_precond_degradation_factor = factor;
+   }
+
+   /**
+    * Make the next call to solve() set up the preconditioner at its
+    * start, for example because the problem has changed.
+    */
+   void
+   resetPreconditioner()
+   {
+      d_precond_is_current = false;
+   }
+
+   /**
+    * Accessory functions to retrieve preconditioner and solve
+    * statistics accumulated since construction.  Times are wall clock
+    * seconds on this process.
+    */
+   int
+   getNumberOfSolves() const
+   {
+      return d_num_solves;
+   }
+
+   ///
+   int
+   getNumberOfSolvesReusingPrecond() const
+   {
+      return d_num_solves_reusing_precond;
+   }
+
+   ///
+   int
+   getNumberOfPrecondSetups() const
+   {
+      return d_num_precond_setups;
+   }
+
+   ///
+   int
+   getNumberOfPrecondSolves() const
+   {
+      return d_num_precond_solves;
+   }
+
+   ///
+   double
+   getSolveTime() const
+   {
+      return d_solve_time;
+   }
+
+   ///
+   double
+   getPrecondSetupTime() const
+   {
+      return d_precond_setup_time;
+   }
+
+   ///
+   double
+   getPrecondSolveTime() const
+   {
+      return d_precond_solve_time;
+   }
+
    /**
     * Accessory functions to retrieve information fom KINSOL.
     *
@@ -708,20 +819,7 @@ private:
       N_Vector fscale,
       void* my_solver,
       N_Vector vtemp1,
-      N_Vector vtemp2)
-   {
-      ((KINSOLSolver *)my_solver)->initializeKINSOL();
-      int num_feval = 0;
-      int success = ((KINSOLSolver *)my_solver)->getKINSOLFunctions()->
-         precondSetup(SABSVEC_CAST(uu),
-            SABSVEC_CAST(uscale),
-            SABSVEC_CAST(fval),
-            SABSVEC_CAST(fscale),
-            SABSVEC_CAST(vtemp1),
-            SABSVEC_CAST(vtemp2),
-            num_feval);
-      return success;
-   }
+      N_Vector vtemp2);
 
    static int
    KINSOLPrecondSolve(
@@ -731,20 +829,7 @@ private:
       N_Vector fscale,
       N_Vector vv,
       void* my_solver,
-      N_Vector vtemp)
-
-   {
-      int num_feval = 0;
-      int success = ((KINSOLSolver *)my_solver)->getKINSOLFunctions()->
-         precondSolve(SABSVEC_CAST(uu),
-            SABSVEC_CAST(uscale),
-            SABSVEC_CAST(fval),
-            SABSVEC_CAST(fscale),
-            SABSVEC_CAST(vv),
-            SABSVEC_CAST(vtemp),
-            num_feval);
-      return success;
-   }
+      N_Vector vtemp);
 
    static int
    KINSOLJacobianTimesVector(
@@ -872,6 +957,33 @@ private:
    // level of verbosity of output
    int d_print_level;
 
+   /*
+    * Preconditioner reuse across solves; see setMaxSolvesReusingPrecond().
+    */
+   int d_max_solves_reusing_precond;
+   double d_precond_degradation_factor;
+
+   // true if the preconditioner may be reused by the next solve
+   bool d_precond_is_current;
+
+   // solves that reused the preconditioner since it was last set up at
+   // the start of a solve
+   int d_solves_since_precond_setup;
+
+   // nonlinear iterations of the last solve starting with a setup
+   int d_fresh_precond_iterations;
+
+   /*
+    * Statistics.
+    */
+   int d_num_solves;
+   int d_num_solves_reusing_precond;
+   int d_num_precond_setups;
+   int d_num_precond_solves;
+   double d_solve_time;
+   double d_precond_setup_time;
+   double d_precond_solve_time;
+
 };
 
 }
@@ -112,6 +112,14 @@ namespace solv {
  *  - @b max_linear_solve_restarts
  *     maximum number of linear solver restarts allowed
  *
+ *  - @b max_solves_reusing_precond
+ *     number of consecutive solves that may reuse the preconditioner set
+ *     up in an earlier solve (see KINSOLSolver::setMaxSolvesReusingPrecond())
+ *
+ *  - @b precond_degradation_factor
+ *     growth in nonlinear iterations of a solve reusing the preconditioner,
+ *     relative to the last solve with a fresh one, that stops the reuse
+ *
  *  - @b KINSOL_log_filename
  *     name of KINSOL log file
  *
@@ -267,6 +275,22 @@ namespace solv {
  *     <td>Parameter read from restart db may be overridden by input db</td>
  *   </tr>
  *   <tr>
+ *     <td>max_solves_reusing_precond</td>
+ *     <td>int</td>
+ *     <td>0</td>
+ *     <td>>=0</td>
+ *     <td>opt</td>
+ *     <td>Parameter read from restart db may be overridden by input db</td>
+ *   </tr>
+ *   <tr>
+ *     <td>precond_degradation_factor</td>
+ *     <td>double</td>
+ *     <td>1.5</td>
+ *     <td>>=1.0</td>
+ *     <td>opt</td>
+ *     <td>Parameter read from restart db may be overridden by input db</td>
+ *   </tr>
+ *   <tr>
  *     <td>KINSOL_log_filename</td>
  *     <td>string</td>
  *     <td>""</td>
@@ -360,6 +384,16 @@ public:
    int
    solve();
 
+   /**
+    * Make the next solve set up the preconditioner instead of reusing
+    * that of an earlier solve.
+    */
+   void
+   resetPreconditioner()
+   {
+      d_KINSOL_solver->resetPreconditioner();
+   }
+
    /**
     * Return pointer to KINSOL solver C++ wrapper object.
     */
@@ -450,6 +484,8 @@ private:
    double d_linear_solver_constant_tolerance;
    int d_max_solves_no_precond_setup;
    int d_max_linear_solve_restarts;
+   int d_max_solves_reusing_precond;
+   double d_precond_degradation_factor;
    std::string d_KINSOL_log_filename;
    int d_KINSOL_print_flag;
    bool d_no_min_eps;
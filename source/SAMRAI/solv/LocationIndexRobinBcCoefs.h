@@ -151,6 +151,25 @@ public:
    hier::IntVector
    numberOfExtensionsFillable() const;
 
+   /*!
+    * @brief Return true: the coefficients depend only on the location
+    * index of the boundary box.
+    */
+   bool
+   areCoefsCacheable() const
+   {
+      return true;
+   }
+
+   /*!
+    * @brief Return false: the coefficients do not depend on time.
+    */
+   bool
+   areCoefsTimeDependent() const
+   {
+      return false;
+   }
+
    /*!
     * @brief Set the boundary value at a given location index.
     *
@@ -171,6 +190,7 @@ public:
       d_a_map[location_index] = 1.0;
       d_b_map[location_index] = 0.0;
       d_g_map[location_index] = value;
+      coefsChanged();
    }
 
    /*!
@@ -193,6 +213,7 @@ public:
       d_a_map[location_index] = 0.0;
       d_b_map[location_index] = 1.0;
       d_g_map[location_index] = slope;
+      coefsChanged();
    }
 
    /*!
@@ -227,6 +248,7 @@ public:
       d_a_map[location_index] = a;
       d_b_map[location_index] = b;
       d_g_map[location_index] = g;
+      coefsChanged();
    }
 
    /*!
@@ -63,6 +63,18 @@ public:
    virtual int
    solve() = 0;
 
+   /**
+    * Make the next solve() set up the preconditioner (and Jacobian
+    * approximation) afresh instead of reusing those of an earlier solve,
+    * for example because the time step changed.  The default
+    * implementation does nothing, which is correct for solvers that do
+    * not reuse them across solves.
+    */
+   virtual void
+   resetPreconditioner()
+   {
+   }
+
 };
 
 }
@@ -124,6 +124,9 @@ public:
     * @param gcoef_data boundary coefficient data.
     *        This array is exactly like @c acoef_data,
     *        except that it is to be filled with the g coefficient.
+    *        When the boundary values of data with several depths
+    *        are being set, the array has the same depth as that data
+    *        and every depth must be filled.
     * @param variable variable to set the coefficients for.
     *        If implemented for multiple variables, this parameter
     *        can be used to determine which variable's coefficients
@@ -167,6 +170,74 @@ public:
 
    //@}
 
+   //@{
+
+   /*!
+    * @name Functions describing whether coefficients may be reused.
+    */
+
+   /*!
+    * @brief Return whether the caller may keep the coefficients set
+    * by setBcCoefs() and reuse them instead of calling it again.
+    *
+    * An implementation returning true promises that the coefficients
+    * depend only on the patch box, the boundary box, the variable and,
+    * if areCoefsTimeDependent() returns true, the fill time, and that
+    * coefsChanged() is called whenever they change otherwise.
+    *
+    * The default returns false, so setBcCoefs() is called for every
+    * boundary fill.
+    */
+   virtual bool
+   areCoefsCacheable() const
+   {
+      return false;
+   }
+
+   /*!
+    * @brief Return whether the coefficients depend on the fill time.
+    *
+    * Used only if areCoefsCacheable() returns true.  If this returns
+    * false, coefficients set for one fill time are reused for all
+    * others.  The default returns true.
+    */
+   virtual bool
+   areCoefsTimeDependent() const
+   {
+      return true;
+   }
+
+   /*!
+    * @brief Return a counter that changes whenever coefsChanged() is
+    * called.
+    *
+    * Callers caching coefficients compare this with the value at the
+    * time they called setBcCoefs() to detect stale coefficients.
+    */
+   int
+   getCoefsVersion() const
+   {
+      return d_coefs_version;
+   }
+
+   //@}
+
+protected:
+   /*!
+    * @brief Invalidate coefficients cached by callers.
+    *
+    * Implementations returning true from areCoefsCacheable() must call
+    * this whenever their coefficients change.
+    */
+   void
+   coefsChanged()
+   {
+      ++d_coefs_version;
+   }
+
+private:
+   int d_coefs_version;
+
 };
 
 }
@@ -186,7 +186,9 @@ public:
     * This function makes a private copy of the relevant ghost cell data
     * that it later uses provide the coefficient g on Dirichlet boundaries.
     * The index must correspond to cell-centered double
-    * data with non-zero ghost width.
+    * data with non-zero ghost width.  All depths of the data are
+    * cached, each providing g for the same depth of the data
+    * being solved for.
     *
     * Functions setHierarchy() and setBoundaries()
     * should be called before this one.
@@ -38,8 +38,9 @@ namespace tbox {
  * be done by using a AsyncCommStage to allocate the groups and to
  * check for completed communications.
  *
- * Supported operations are currently broadcast, gather and sum
- * reduce.  Only integer data is supported.
+ * Supported operations are currently broadcast, gather, sum reduce
+ * and sum all-reduce (a sum reduce followed by a broadcast of the
+ * result).  Only integer data is supported.
  *
  * A tree is an acyclic graph in which a node at position pos has
  * nchild children, and the following positions for its
@@ -63,6 +64,15 @@ namespace tbox {
  * faster than using this class, but the cost of creating MPI
  * communicators MAY be expensive.
  *
+ * Large broadcasts and reductions can be pipelined by setting a
+ * segment size (see setSegmentSize()).  The data is then sent along
+ * the tree one segment at a time, so a process forwards the first
+ * segment while its parent or children are still working on the
+ * next, and the time for the whole operation grows with the tree
+ * depth plus the number of segments rather than with their product.
+ * Reductions also need internal storage for only one segment per
+ * child.
+ *
  * This class supports communication and uses MPI for message passing.
  * If MPI is disabled, the job of this class disappears and the class
  * is effectively empty.  The public interfaces still remain so the
@@ -278,6 +288,34 @@ public:
       d_use_blocking_send_to_children = flag;
    }
 
+   /*!
+    * @brief Set the number of integers sent per message in broadcasts
+    * and reductions.
+    *
+    * Payloads larger than segment_size are sent in segments of
+    * segment_size integers, each passing through the tree in turn.
+    * Zero (the default) sends each payload in one message.  Gathers
+    * and operations done with MPI collectives are not segmented.
+    *
+    * When segmenting, all processes must use the same segment size
+    * and the same data size, including the root of a broadcast.
+    *
+    * @pre isDone()
+    * @pre segment_size >= 0
+    */
+   void
+   setSegmentSize(
+      int segment_size);
+
+   /*!
+    * @brief Returns the segment size set by setSegmentSize().
+    */
+   int
+   getSegmentSize() const
+   {
+      return d_segment_size;
+   }
+
    //@{
 
    /*!
@@ -394,6 +432,38 @@ public:
       return checkReduce();
    }
 
+   /*!
+    * @brief Begin a sum all-reduce communication.
+    *
+    * The sum is reduced to the root and then broadcast from the root,
+    * so every process in the group gets the sum in buffer.  All
+    * processes must give the same size.
+    *
+    * If this method returns false, checkSumAllReduce() must be called
+    * until it returns true before any change in object state is
+    * allowed.
+    *
+    * @return Whether operation is completed.
+    *
+    * @pre getNextTaskOp() == none
+    */
+   bool
+   beginSumAllReduce(
+      int* buffer,
+      int size);
+
+   /*!
+    * @brief Check the current sum all-reduce communication and
+    * complete it if all MPI requests are fulfilled.
+    *
+    * @return Whether operation is completed.
+    */
+   bool
+   checkSumAllReduce()
+   {
+      return proceedToNextWait();
+   }
+
    /*!
     * @brief Check the current communication and complete it if all
     * MPI requests are fulfilled.
@@ -517,6 +587,43 @@ private:
    bool
    checkReduce();
 
+   /*!
+    * @brief Advance the reduction of the current segment.
+    *
+    * @return Whether the segment is completed.
+    */
+   bool
+   checkReduceSegment();
+
+   /*!
+    * @brief Advance the broadcast of the current segment.
+    *
+    * @return Whether the segment is completed.
+    */
+   bool
+   checkBcastSegment();
+
+   /*!
+    * @brief Start the next segment of the current operation.
+    *
+    * @return False if the current segment was the last one.
+    *
+    * @pre getNextTaskOp() == none
+    */
+   bool
+   beginNextSegment();
+
+   /*!
+    * @brief Number of integers in the current segment.
+    */
+   int
+   getSegmentLength() const
+   {
+      const int remaining = d_external_size - d_segment_begin;
+      return d_segment_size > 0 && d_segment_size < remaining ?
+             d_segment_size : remaining;
+   }
+
    /*!
     * @brief Perform reduction on data that after it has been brought
     * to the local process.
@@ -526,7 +633,8 @@ private:
    void
    reduceData(
       int* output,
-      const int* data) const;
+      const int* data,
+      int size) const;
 
    /*!
     * @brief Compute the data that depends on the group definition.
@@ -754,6 +862,22 @@ private:
    bool d_use_blocking_send_to_children;
    bool d_use_blocking_send_to_parent;
 
+   /*!
+    * @brief Number of integers per message (zero for unsegmented).
+    */
+   int d_segment_size;
+
+   /*!
+    * @brief Offset in d_external_buf of the current segment.
+    */
+   int d_segment_begin;
+
+   /*!
+    * @brief Whether the current reduce is the first half of an
+    * all-reduce, to be followed by a broadcast.
+    */
+   bool d_bcast_after_reduce;
+
    // Make some temporary variable statuses to avoid repetitious allocations.
    SAMRAI_MPI::Status d_mpi_status;
 
@@ -1610,6 +1610,30 @@ public:
       }
    }
 
+   /**
+    * Copy the entry with the specified key name from another database
+    * into this one, replacing any entry with the same key.  A database
+    * entry is copied recursively.
+    *
+    * @param source Database holding the entry.
+    * @param key    Key name in both databases.
+    *
+    * @pre source.keyExists(key)
+    */
+   void
+   copyEntry(
+      Database& source,
+      const std::string& key);
+
+   /**
+    * Copy all entries of another database, recursively, into this one.
+    *
+    * @param source Database to copy.
+    */
+   void
+   copyDatabase(
+      Database& source);
+
    /**
     * @brief Returns the name of this database.
     *
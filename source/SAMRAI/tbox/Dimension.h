@@ -38,6 +38,16 @@ class DatabaseBox;
  * A class is used rather than a simple short or integer to provide
  * enhanced type safety.
  *
+ * The dimension may also be fixed at compile time using the
+ * --with-dim flag to the configure script, which defines
+ * SAMRAI_FIXED_DIMENSION and sets the maximum dimension to it.  Then
+ * getValue() returns the fixed dimension as a constant, so the loops over
+ * directions in Box, Index, IntVector, the patch data iterators and the
+ * array operations have a trip count known to the compiler and can be
+ * unrolled.  Dimension objects of other values may still be created and
+ * compared, but all objects used in computations must have the fixed
+ * dimension.  With dimension assertions enabled, getValue() checks this.
+ *
  */
 
 class Dimension
@@ -135,7 +145,12 @@ public:
    unsigned short
    getValue() const
    {
+#ifdef SAMRAI_FIXED_DIMENSION
+      TBOX_DIM_ASSERT(d_dim == SAMRAI_FIXED_DIMENSION);
+      return SAMRAI_FIXED_DIMENSION;
+#else
       return d_dim;
+#endif
    }
 
    /**
@@ -0,0 +1,178 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2017 Lawrence Livermore National Security, LLC
+ * Description:   Hardware performance counters attached to timers.
+ *
+ ************************************************************************/
+
+#ifndef included_tbox_HardwareCounters
+#define included_tbox_HardwareCounters
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include <string>
+
+namespace SAMRAI {
+namespace tbox {
+
+/*!
+ * @brief Class HardwareCounters reads a group of hardware performance
+ * counters of the calling thread between start() and stop(), the way a
+ * Timer measures time.
+ *
+ * The counters are cycles, retired instructions and last-level cache
+ * misses.  They are opened with the Linux perf_event_open system call,
+ * counting user-space events of the calling thread only; threads
+ * created afterwards (e.g., OpenMP workers) are not counted.  The bytes
+ * moved from memory are estimated as the cache misses times the cache
+ * line size, which is the closest quantity perf exposes portably.
+ *
+ * The class is compiled only where configure finds <linux/perf_event.h>
+ * (HAVE_LINUX_PERF_EVENT_H).  Elsewhere, and when the kernel refuses the
+ * counters (e.g., because of /proc/sys/kernel/perf_event_paranoid),
+ * isAvailable() returns false and start() and stop() do nothing.
+ *
+ * Each object opens its own group, which takes NUM_EVENTS file
+ * descriptors.  When more groups are open than the processor has
+ * counters, the kernel multiplexes them and the counts are scaled by
+ * the fraction of time each group was running, so they are estimates.
+ *
+ * Objects are created by TimerManager for the timers listed in its
+ * counter_list input and are not meant to be used directly.
+ *
+ * @see TimerManager
+ */
+class HardwareCounters
+{
+public:
+   /*!
+    * @brief The counted events.
+    */
+   enum Event {
+      CYCLES = 0,
+      INSTRUCTIONS = 1,
+      CACHE_MISSES = 2,
+      NUM_EVENTS = 3
+   };
+
+   /*!
+    * @brief Open the counter group for the calling thread.
+    */
+   HardwareCounters();
+
+   /*!
+    * @brief Close the counter group.
+    */
+   ~HardwareCounters();
+
+   /*!
+    * @brief Whether the counters could be opened.
+    */
+   bool
+   isAvailable() const
+   {
+      return d_group_fd >= 0;
+   }
+
+   /*!
+    * @brief Take the counter values at the start of a measured interval.
+    */
+   void
+   start();
+
+   /*!
+    * @brief Accumulate the counts since the matching start().
+    */
+   void
+   stop();
+
+   /*!
+    * @brief Zero the accumulated counts.
+    */
+   void
+   reset();
+
+   /*!
+    * @brief Accumulated count of an event over all start/stop
+    * intervals.
+    */
+   double
+   getTotal(
+      const Event event) const
+   {
+      return d_total[event];
+   }
+
+   /*!
+    * @brief Estimate of the bytes moved from memory: cache misses times
+    * the cache line size.
+    */
+   double
+   getEstimatedMemoryBytes() const
+   {
+      return d_total[CACHE_MISSES] * s_cache_line_bytes;
+   }
+
+   /*!
+    * @brief Name of an event for printing.
+    */
+   static const char *
+   getEventName(
+      const Event event);
+
+   /*!
+    * @brief Number of counter groups currently open by all objects.
+    */
+   static int
+   getNumberOfOpenGroups()
+   {
+      return s_num_open_groups;
+   }
+
+private:
+   // Unimplemented copy constructor.
+   HardwareCounters(
+      const HardwareCounters& other);
+
+   // Unimplemented assignment operator.
+   HardwareCounters&
+   operator = (
+      const HardwareCounters& rhs);
+
+   /*
+    * Read the current values of the group into values.  Returns false
+    * if the read failed.
+    */
+   bool
+   readGroup(
+      double values[NUM_EVENTS]) const;
+
+   /*
+    * File descriptors of the group leader and of each event.  Negative
+    * when not opened.
+    */
+   int d_group_fd;
+   int d_fds[NUM_EVENTS];
+
+   double d_start[NUM_EVENTS];
+   double d_total[NUM_EVENTS];
+
+   /*
+    * Size of a cache line, used to turn cache misses into bytes.
+    */
+   static const double s_cache_line_bytes;
+
+   /*
+    * Number of groups currently open, see getNumberOfOpenGroups().
+    */
+   static int s_num_open_groups;
+
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,325 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2017 Lawrence Livermore National Security, LLC
+ * Description:   In-memory checkpoints with partner or XOR redundancy
+ *
+ ************************************************************************/
+
+#ifndef included_tbox_MemoryCheckpointManager
+#define included_tbox_MemoryCheckpointManager
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/tbox/Database.h"
+#include "SAMRAI/tbox/MessageStream.h"
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
+#include "SAMRAI/tbox/Timer.h"
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace SAMRAI {
+namespace tbox {
+
+/**
+ * Class MemoryCheckpointManager writes checkpoints of the objects
+ * registered with the RestartManager into the memory of the processes
+ * instead of restart files, so that checkpoints can be taken much more
+ * often than disk restart files.
+ *
+ * A checkpoint calls putToRestart() of every registered object, exactly
+ * as RestartManager::writeRestartFile() does, but into a MemoryDatabase.
+ * The database is packed into a byte image that each process keeps.  To
+ * survive the loss of a process (for example the replacement of a failed
+ * node by a spare), redundant data is kept on other processes:
+ *
+ *   - PARTNER: each process also keeps the image of one partner
+ *     process.  This doubles the memory of the images, and the data of a
+ *     process is lost only if the process and the one holding its copy
+ *     are both lost.
+ *
+ *   - XOR: processes form groups of (about) xor_group_size processes,
+ *     and each process keeps one part of the XOR parity of the images of
+ *     the others in its group.  The extra memory is about 1/(n-1) of the
+ *     largest image in a group of n processes, and any one process per
+ *     group can be rebuilt.
+ *
+ * Every disk_flush_interval-th checkpoint is also written to disk with
+ * RestartManager::writeRestartFile(), to protect against the loss of
+ * more processes than the redundancy covers.
+ *
+ * To restart from memory, all processes call openCheckpoint().  A
+ * process whose images have been lost (such as a new process started in
+ * place of a failed one, or one that called discardLocalImages()) gets
+ * its image rebuilt from the other processes; the other processes use
+ * the image they already have.  openCheckpoint() then sets the root
+ * database of the RestartManager to the unpacked image, so the objects
+ * are rebuilt through their usual restart constructors and
+ * getFromRestart() methods, as after RestartManager::openRestartFile().
+ *
+ * The partner of process r in PARTNER mode is r + partner_distance
+ * (modulo the number of processes).  XOR groups are made of processes
+ * whose ranks are equal modulo the number of groups.  Processes sharing
+ * a node usually have consecutive ranks, so partner_distance should be
+ * at least the number of processes per node, and there should be at
+ * least as many groups as processes per node, for the redundant data
+ * to be kept on other nodes.
+ *
+ * Input parameters (all optional):
+ *
+ *   - \b redundancy
+ *      "PARTNER" or "XOR" (default "PARTNER").
+ *
+ *   - \b partner_distance
+ *      distance in rank to the partner process, positive (default 1).
+ *
+ *   - \b xor_group_size
+ *      number of processes in an XOR group, at least 2 (default 8).
+ *
+ *   - \b disk_flush_interval
+ *      write every n-th checkpoint to disk too; zero or less never
+ *      writes to disk (default 0).
+ *
+ * A sample input database entry:
+ *
+ * @code
+ *    redundancy = "XOR"
+ *    xor_group_size = 8
+ *    disk_flush_interval = 10
+ * @endcode
+ *
+ * @see RestartManager
+ */
+
+class MemoryCheckpointManager
+{
+public:
+   /**
+    * Constructor.
+    *
+    * @param object_name
+    * @param input_db  Input database, may be null.
+    * @param mpi  Processes taking part in the checkpoints.
+    */
+   MemoryCheckpointManager(
+      const std::string& object_name,
+      const std::shared_ptr<Database>& input_db =
+         std::shared_ptr<Database>(),
+      const SAMRAI_MPI& mpi = SAMRAI_MPI::getSAMRAIWorld());
+
+   /**
+    * Destructor.
+    */
+   ~MemoryCheckpointManager();
+
+   /**
+    * Write all objects registered with the RestartManager to an
+    * in-memory checkpoint, replacing the previous one, and update the
+    * redundant data on the other processes.  This is collective.
+    *
+    * If this is a multiple of the disk flush interval, the checkpoint is
+    * also written with RestartManager::writeRestartFile(root_dirname,
+    * restore_num).
+    */
+   void
+   writeCheckpoint(
+      const std::string& root_dirname,
+      const int restore_num);
+
+   /**
+    * Restore the last in-memory checkpoint and make it the root database
+    * of the RestartManager.  This is collective.  Lost images are rebuilt
+    * from the redundant data; it is an error if too many processes lost
+    * their images for the redundancy to recover them.
+    *
+    * Returns false if no process has a checkpoint, true otherwise.
+    */
+   bool
+   openCheckpoint();
+
+   /**
+    * Release the root database set by openCheckpoint().
+    */
+   void
+   closeCheckpoint();
+
+   /**
+    * Drop the images held by this process, as if the process had been
+    * replaced.  This is mostly for testing the recovery.
+    */
+   void
+   discardLocalImages();
+
+   /**
+    * Return true if this process holds its image of the last checkpoint.
+    */
+   bool
+   hasLocalImage() const
+   {
+      return d_have_image;
+   }
+
+   /**
+    * Return the restore number of the last checkpoint, or -1 if there
+    * is none on this process.
+    */
+   int
+   getRestoreNumber() const
+   {
+      return d_restore_num;
+   }
+
+   /**
+    * Return the number of checkpoints written.
+    */
+   int
+   getNumberOfCheckpoints() const
+   {
+      return d_num_checkpoints;
+   }
+
+   /**
+    * Return the size in bytes of the image of this process.
+    */
+   size_t
+   getImageSize() const
+   {
+      return d_image.size();
+   }
+
+   /**
+    * Return the size in bytes of the redundant data held by this
+    * process for other processes.
+    */
+   size_t
+   getRedundantDataSize() const
+   {
+      return d_mode == PARTNER ? d_partner_image.size() : d_parity.size();
+   }
+
+   /**
+    * Return the name of this object.
+    */
+   const std::string&
+   getObjectName() const
+   {
+      return d_object_name;
+   }
+
+   /**
+    * Print out all members of the class instance to given output
+    * stream.
+    */
+   void
+   printClassData(
+      std::ostream& os) const;
+
+private:
+   enum RedundancyMode { PARTNER, XOR };
+
+   /*
+    * Unimplemented copy constructor and assignment.
+    */
+   MemoryCheckpointManager(
+      const MemoryCheckpointManager&);
+   MemoryCheckpointManager&
+   operator = (
+      const MemoryCheckpointManager&);
+
+   /*
+    * Pack all entries of a database, recursively, into a stream.
+    */
+   static void
+   packDatabase(
+      MessageStream& stream,
+      Database& database);
+
+   /*
+    * Unpack database entries written by packDatabase().
+    */
+   static void
+   unpackDatabase(
+      MessageStream& stream,
+      Database& database);
+
+   /*
+    * Send the image to the partner and receive the image of the
+    * process that has this one as partner.
+    */
+   void
+   exchangePartnerImages();
+
+   /*
+    * Compute the XOR parity held by this process.
+    */
+   void
+   computeXorParity();
+
+   /*
+    * Rebuild lost images (and the redundant data of their processes).
+    */
+   void
+   recoverPartnerImages(
+      const std::vector<int>& lost);
+   void
+   recoverXorImages(
+      const std::vector<int>& lost);
+
+   /*
+    * Get the ranks of the XOR group of a process.
+    */
+   void
+   getXorGroup(
+      int rank,
+      std::vector<int>& members) const;
+
+   /*
+    * Get the length of the parity chunks of an XOR group.
+    */
+   size_t
+   getXorChunkLength(
+      const std::vector<int>& members) const;
+
+   void
+   getFromInput(
+      const std::shared_ptr<Database>& input_db);
+
+   std::string d_object_name;
+
+   SAMRAI_MPI d_mpi;
+
+   RedundancyMode d_mode;
+   int d_partner_distance;
+   int d_xor_group_size;
+   int d_disk_flush_interval;
+
+   /*
+    * Image of this process, and the redundant data for other processes:
+    * the image of the process whose partner this is, or the XOR parity.
+    */
+   std::vector<char> d_image;
+   std::vector<char> d_partner_image;
+   std::vector<char> d_parity;
+
+   /*
+    * Image sizes of all processes, needed to rebuild XOR images.
+    */
+   std::vector<int> d_image_sizes;
+
+   bool d_have_image;
+   int d_restore_num;
+   int d_num_checkpoints;
+
+   std::shared_ptr<Timer> t_write_checkpoint;
+   std::shared_ptr<Timer> t_open_checkpoint;
+};
+
+}
+}
+
+#endif
@@ -39,11 +39,45 @@ namespace tbox {
  * profile of the recorded memory information so that it can be analyzed
  * via a post-processing tool.
  *
+ * The mallinfo numbers cannot say which part of SAMRAI holds the
+ * memory, so the library also keeps category-tagged accounting of its
+ * large data structures.  Allocation sites call recordAllocation() and
+ * recordDeallocation() with a MemoryCategory, and a current and a
+ * high-water value is kept for each category.  The accounted sizes
+ * are the payload and container-node estimates of the structures, not
+ * the bytes the allocator actually handed out, so the sum over all
+ * categories is normally less than the mallinfo numbers.
+ * printCategoryMemory() reduces the values across ranks and prints
+ * them.  TimerManager calls it after the timer tables when its
+ * print_memory input is TRUE.  The accounting is a few additions per
+ * allocation and is always on.  It is not thread-safe; counts from
+ * allocations made inside threaded regions may be lost.
+ *
  * Note that all member functions of this class are static so it is not
  * necessary to instantiate the class.  Simply call the functions as
  * static functions; e.g.,MemoryUtilities::function(...).
  */
 struct MemoryUtilities {
+   /*!
+    * @brief Categories of memory accounted by recordAllocation().
+    *
+    * - PATCH_DATA: Patch data allocated through PatchDataFactory.
+    * - BOX_LEVELS: Local boxes of BoxLevels.
+    * - GLOBALIZED_BOX_LEVELS: Global boxes of globalized BoxLevels.
+    * - CONNECTORS: Relationships stored in Connectors.
+    * - SCHEDULES: Transactions held by communication Schedules.
+    * - COMM_BUFFERS: Message buffers (MessageStream, AsyncCommPeer).
+    */
+   enum MemoryCategory {
+      PATCH_DATA = 0,
+      BOX_LEVELS = 1,
+      GLOBALIZED_BOX_LEVELS = 2,
+      CONNECTORS = 3,
+      SCHEDULES = 4,
+      COMM_BUFFERS = 5,
+      NUM_MEMORY_CATEGORIES = 6
+   };
+
    /*!
     * Print memory information to the supplied output stream.
     */
@@ -80,6 +114,84 @@ struct MemoryUtilities {
    align(
       const size_t bytes);
 
+   /*!
+    * @brief Account an allocation of the given number of bytes to a
+    * category, updating the category's high-water mark.
+    */
+   static void
+   recordAllocation(
+      const MemoryCategory category,
+      const size_t bytes)
+   {
+      s_category_current[category] += bytes;
+      if (s_category_current[category] > s_category_peak[category]) {
+         s_category_peak[category] = s_category_current[category];
+      }
+   }
+
+   /*!
+    * @brief Account the release of bytes previously given to
+    * recordAllocation() for the same category.
+    */
+   static void
+   recordDeallocation(
+      const MemoryCategory category,
+      const size_t bytes)
+   {
+      s_category_current[category] -= bytes;
+   }
+
+   /*!
+    * @brief Bytes currently accounted to a category on this process.
+    */
+   static size_t
+   getCurrentCategoryMemory(
+      const MemoryCategory category)
+   {
+      return s_category_current[category];
+   }
+
+   /*!
+    * @brief High-water mark of a category on this process.
+    */
+   static size_t
+   getPeakCategoryMemory(
+      const MemoryCategory category)
+   {
+      return s_category_peak[category];
+   }
+
+   /*!
+    * @brief Reset the high-water marks of all categories to their
+    * current values.
+    *
+    * Use this to measure the peaks of a single phase of a computation.
+    */
+   static void
+   resetPeakCategoryMemory();
+
+   /*!
+    * @brief Return the name of a category, as printed by
+    * printCategoryMemory().
+    */
+   static const char *
+   getCategoryName(
+      const MemoryCategory category);
+
+   /*!
+    * @brief Print the current and peak memory of each category.
+    *
+    * For each category this prints the local values and the sum and
+    * maximum across ranks of both the current and the peak values.
+    * Note that the peaks of different categories are generally not
+    * reached at the same time.
+    *
+    * This method is collective over SAMRAI_MPI::getSAMRAIWorld().
+    */
+   static void
+   printCategoryMemory(
+      std::ostream& os);
+
 private:
    /*
     * Keep track of maximum memory used (updated each time print or
@@ -87,6 +199,12 @@ private:
     */
    static double s_max_memory;
 
+   /*
+    * Current and high-water accounted bytes of each category.
+    */
+   static size_t s_category_current[NUM_MEMORY_CATEGORIES];
+   static size_t s_category_peak[NUM_MEMORY_CATEGORIES];
+
    enum { ArenaAllocationAlignment = 16 };
 };
 
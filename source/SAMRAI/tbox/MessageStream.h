@@ -333,9 +333,19 @@ private:
             static_cast<const char *>(input_data) + num_bytes);
          d_buffer_size = d_write_buffer.size();
          d_buffer_index += num_bytes;
+         if (d_write_buffer.capacity() != d_accounted_memory) {
+            accountMemory();
+         }
       }
    }
 
+   /*!
+    * @brief Account the size of the buffer owned by the stream to
+    * MemoryUtilities::COMM_BUFFERS.
+    */
+   void
+   accountMemory();
+
    /*!
     * @brief Copy data out of the stream, advancing the stream pointer.
     *
@@ -400,6 +410,12 @@ private:
     */
    bool d_deep_copy_read;
 
+   /*!
+    * @brief Bytes of the stream's own buffer accounted to
+    * MemoryUtilities::COMM_BUFFERS.
+    */
+   size_t d_accounted_memory;
+
 };
 
 }
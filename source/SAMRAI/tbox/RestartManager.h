@@ -19,7 +19,10 @@
 
 #include <string>
 #include <list>
+#include <map>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace SAMRAI {
 namespace tbox {
@@ -73,6 +76,18 @@ namespace tbox {
  * both a restart directory name and a restore number for its arguments.
  * See comments for member functions for more details.
  *
+ * Restart files may be written incrementally (see
+ * setIncrementalRestart()).  An incremental restart file holds only the
+ * data that changed since the previous restart file: each registered
+ * object and each nested database (such as the data of a patch level, of
+ * a patch or of one patch data) whose content hash is the same as in the
+ * previous file is replaced by a reference to the earlier file holding
+ * it.  openRestartFile() and readRestartFile() follow the references, so
+ * objects restart as from a full restart file, but the earlier files
+ * must be kept.  The restart-compact tool rewrites an incremental
+ * restart file as a full one, after which the earlier files may be
+ * removed; this must also be done before using other tools on it.
+ *
  * @see Database
  */
 
@@ -235,6 +250,59 @@ public:
       const std::string& root_dirname,
       const int restore_num);
 
+   /**
+    * Turn incremental restart files on or off (see the class
+    * description).  When turning them on, every full_restart_interval-th
+    * restart file is written in full so that older files can be deleted;
+    * zero or less writes all but the first incrementally.  A restart file
+    * is also written in full when the root directory or the number of
+    * processes differs from that of the previous one.
+    */
+   void
+   setIncrementalRestart(
+      bool incremental,
+      int full_restart_interval = 0)
+   {
+      d_incremental_restart = incremental;
+      d_full_restart_interval = full_restart_interval;
+      d_restart_hashes.clear();
+      d_num_incremental_files = 0;
+   }
+
+   /*!
+    * @brief Returns true if restart files are written incrementally.
+    */
+   bool
+   getIncrementalRestart() const
+   {
+      return d_incremental_restart;
+   }
+
+   /*!
+    * @brief Returns the number of databases of the last restart file
+    * that were written as references to earlier files.
+    */
+   int
+   getNumberOfRestartReferences() const
+   {
+      return d_num_restart_references;
+   }
+
+   /**
+    * Read the restart file of the given process and return its content.
+    * If it is an incremental restart file, the content of the earlier
+    * files it refers to is copied in, so the returned database holds the
+    * complete data.  The restart manager state is not changed.
+    *
+    * @pre hasDatabaseFactory()
+    */
+   std::shared_ptr<Database>
+   readRestartFile(
+      const std::string& root_dirname,
+      const int restore_num,
+      const int num_nodes,
+      const int proc_num);
+
    /**
     * Write all objects registered to as restart objects to the
     * restart database.
@@ -244,6 +312,20 @@ public:
    void
    writeRestartToDatabase();
 
+   /**
+    * Write all objects registered to as restart objects to the
+    * given database, such as a MemoryDatabase for an in-memory
+    * checkpoint.
+    *
+    * @pre database
+    */
+   void
+   writeRestartToDatabase(
+      const std::shared_ptr<Database>& database)
+   {
+      writeRestartFile(database);
+   }
+
 protected:
    /**
     * The constructor for RestartManager is protected.
@@ -292,6 +374,68 @@ private:
    writeRestartFile(
       const std::shared_ptr<Database>& database);
 
+   /*
+    * Write the registered objects to an incremental restart file,
+    * referring to earlier files for data that have not changed.
+    */
+   void
+   writeIncrementalRestartFile(
+      const std::shared_ptr<Database>& database,
+      const std::string& root_dirname,
+      int restore_num);
+
+   /*
+    * Write the entries of source that changed since the last restart
+    * file into destination, recording the content hash and the restore
+    * number of the file holding each database.
+    */
+   void
+   writeChangedEntries(
+      Database& source,
+      Database& destination,
+      const std::string& path,
+      const std::map<std::string, unsigned long long>& hashes,
+      int restore_num,
+      bool full,
+      std::map<std::string, std::pair<unsigned long long, int> >& new_hashes);
+
+   /*
+    * Return the complete content of an opened restart file: the file
+    * itself, or for an incremental restart file a MemoryDatabase with
+    * the references resolved.
+    */
+   std::shared_ptr<Database>
+   resolveIncrementalRestartFile(
+      const std::shared_ptr<Database>& database,
+      const std::string& root_dirname,
+      int num_nodes,
+      int proc_num);
+
+   /*
+    * Copy source into destination, replacing references to earlier
+    * restart files by the data they refer to.  path holds the keys
+    * leading from the root to source.
+    */
+   void
+   resolveRestartReferences(
+      Database& source,
+      Database& destination,
+      std::vector<std::string>& path,
+      const std::string& root_dirname,
+      int num_nodes,
+      int proc_num,
+      std::map<int, std::shared_ptr<Database> >& files);
+
+   /*
+    * Return the name of a restart file.
+    */
+   std::string
+   getRestartFilename(
+      const std::string& root_dirname,
+      int restore_num,
+      int num_nodes,
+      int proc_num) const;
+
    /*
     * Create the directory structure for the data files.
     * The directory structure created is
@@ -336,6 +480,20 @@ private:
 
    bool d_is_from_restart;
 
+   /*
+    * Incremental restart state: content hash and holding restore number
+    * of every database of the last restart file, keyed by the path of
+    * keys (separated by null characters) from the root.
+    */
+   bool d_incremental_restart;
+   int d_full_restart_interval;
+   int d_num_incremental_files;
+   int d_num_restart_references;
+   std::string d_incremental_dirname;
+   int d_incremental_num_nodes;
+   int d_incremental_restore_num;
+   std::map<std::string, std::pair<unsigned long long, int> > d_restart_hashes;
+
    static StartupShutdownManager::Handler s_shutdown_handler;
 };
 
@@ -18,6 +18,7 @@
 #include "SAMRAI/tbox/MessageStream.h"
 #include "SAMRAI/tbox/Transaction.h"
 
+#include <fstream>
 #include <iostream>
 #include <map>
 #include <list>
@@ -48,7 +49,26 @@ namespace tbox {
  * order of transaction execution matters.  The transactions will be
  * executed in the order in which they appear in the list.
  *
+ * The communication pattern of every schedule execution can be
+ * recorded for offline analysis and replay (see the tools/commreplay
+ * utility).  Recording is turned on by the input parameter
+ * DEV_comm_pattern_file in the Schedule input database.  Each process
+ * writes the pattern to the file DEV_comm_pattern_file.<rank>, with
+ * one record per execution:
+ * @verbatim
+ * E <execution> <timer prefix> <local transactions> <local bytes> <sends> <recvs>
+ * S <peer rank> <bytes> <size known (0/1)> (one line per send)
+ * R <peer rank> <bytes> <size known (0/1)> (one line per receive)
+ * @endverbatim
+ * Executions are numbered consecutively on each process, so records
+ * with the same execution number on different processes belong to the
+ * same (collective) schedule execution.
+ *
+ * Several schedules executed back to back can be combined into one
+ * communication phase with ScheduleGroup.
+ *
  * @see Transaction
+ * @see ScheduleGroup
  */
 
 class Schedule
@@ -186,9 +206,18 @@ public:
     * message protocol SAMRAI uses of sending some small amount of
     * data with the first message does exploit this property and will
     * save the cost of always communicating two messages for small
-    * messages.  Currently SAMRAI does not attempt to automatically
-    * determine this message length however that may be added in
-    * future versions.
+    * messages.
+    *
+    * Unless turned off by the Schedule input parameter
+    * DEV_adapt_first_message_length, the first message length used
+    * with each peer is adapted to the size of the message exchanged
+    * with that peer in the previous execution, plus 1/8 for growth, so
+    * that messages of repeated executions whose size does not change
+    * much complete in one message.  The sender and the receiver both
+    * see the same message size, so they agree on the length without
+    * additional communication.  first_message_length is the lower
+    * bound of the adapted length, and the Schedule input parameter
+    * DEV_max_first_message_length (default 1048576) is its upper bound.
     *
     * first_message_length defaults to 1000.
     *
@@ -288,6 +317,12 @@ public:
    }
 
 private:
+   /*
+    * ScheduleGroup packs and unpacks the transactions of its member
+    * schedules directly.
+    */
+   friend class ScheduleGroup;
+
    void
    allocateCommunicationObjects();
    void
@@ -310,6 +345,33 @@ private:
    void
    deallocateSendBuffers();
 
+   /*!
+    * @brief Write the communication pattern of the execution just
+    * completed to the pattern file.
+    */
+   void
+   recordCommPattern();
+
+   /*!
+    * @brief Return the first message length to use for a peer after
+    * exchanging a message of message_size bytes with it.
+    *
+    * @param[in] min_length Lower bound of the length.
+    * @param[in] message_size
+    */
+   static size_t
+   adaptFirstMessageLength(
+      size_t min_length,
+      size_t message_size);
+
+   /*!
+    * @brief Whether the receiver can compute the size of the message
+    * carrying the given transactions.
+    */
+   static bool
+   canEstimateMessageSize(
+      const std::list<std::shared_ptr<Transaction> >& transactions);
+
    Schedule(
       const Schedule&);                 // not implemented
    Schedule&
@@ -328,6 +390,14 @@ private:
       getAllTimers(s_default_timer_prefix, timers);
    }
 
+   /*!
+    * @brief Close the communication pattern file.
+    *
+    * Only called by StartupShutdownManager.
+    */
+   static void
+   finalizeCallback();
+
    /*!
     * @brief Read input data from input database and initialize class members.
     */
@@ -393,6 +463,16 @@ private:
     */
    size_t d_first_message_length;
 
+   /*!
+    * @brief First message lengths adapted to the messages of the
+    * previous execution, by peer rank.
+    *
+    * See setFirstMessageLength().  Peers without an entry use
+    * d_first_message_length.
+    */
+   std::map<int, size_t> d_send_first_message_lengths;
+   std::map<int, size_t> d_recv_first_message_lengths;
+
    /*!
     * @brief Whether to unpack messages in a deterministic order.
     *
@@ -400,10 +480,53 @@ private:
     */
    bool d_unpack_in_deterministic_order;
 
+   //@{
+   //! @name Communication pattern recording.
+
+   /*!
+    * @brief Timer prefix, which labels the executions in the
+    * communication pattern file.
+    */
+   std::string d_timer_prefix;
+
+   /*!
+    * @brief Message sizes (bytes) of the current execution, by peer rank.
+    * Kept only while recording the communication pattern.
+    */
+   std::map<int, size_t> d_recorded_send_sizes;
+   std::map<int, size_t> d_recorded_recv_sizes;
+
+   /*!
+    * @brief Prefix of the communication pattern files.  Empty if not
+    * recording.
+    */
+   static std::string s_comm_pattern_file_prefix;
+
+   /*!
+    * @brief Stream for the communication pattern file, opened when
+    * the input is read by the first Schedule constructed.
+    */
+   static std::ofstream* s_comm_pattern_stream;
+
+   /*!
+    * @brief Number of executions recorded by this process.
+    */
+   static int s_num_recorded_executions;
+
+   //@}
+
    static const int s_default_first_tag;
    static const int s_default_second_tag;
    static const size_t s_default_first_message_length;
 
+   /*!
+    * @brief Whether to adapt first message lengths to previous
+    * executions, and the largest length used.  See
+    * setFirstMessageLength().
+    */
+   static bool s_adapt_first_message_length;
+   static size_t s_max_first_message_length;
+
    //@{
    //! @name Timer data for Schedule class.
 
@@ -0,0 +1,330 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2017 Lawrence Livermore National Security, LLC
+ * Description:   Execution of several schedules as one communication phase
+ *
+ ************************************************************************/
+#ifndef included_tbox_ScheduleGroup
+#define included_tbox_ScheduleGroup
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/tbox/AsyncCommPeer.h"
+#include "SAMRAI/tbox/AsyncCommStage.h"
+#include "SAMRAI/tbox/MessageStream.h"
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
+#include "SAMRAI/tbox/Schedule.h"
+#include "SAMRAI/tbox/Timer.h"
+
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace SAMRAI {
+namespace tbox {
+
+/*!
+ * @brief Class ScheduleGroup executes a sequence of Schedule objects
+ * as a single communication phase.
+ *
+ * Executing the schedules one after another sends one message per
+ * peer per schedule and waits on each schedule in turn.  A
+ * ScheduleGroup instead packs the transactions of all member
+ * schedules going to a peer into a single message, so each pair of
+ * communicating processes exchanges one message (two if the size is
+ * not known to the receiver and exceeds the first message length) and
+ * all messages are completed by one wait.
+ *
+ * The data written into the destinations is the same as executing the
+ * members in the order they were appended:
+ *
+ * - The local copies of each member are done before the received data
+ *   of that member is unpacked, as in Schedule::communicate().
+ * - All writes of a member, local and remote, are done before any
+ *   write of the next member.
+ *
+ * The sources of all members are packed when the communication
+ * begins, so a member must not read data written by an earlier member
+ * of the same group.  Schedules with such a dependency must be
+ * executed in separate groups (or individually).
+ *
+ * The first member unpacks the messages as they arrive, like Schedule;
+ * the later members unpack their parts in the order of peer ranks.  If
+ * any member has the deterministic unpack ordering flag set (see
+ * Schedule::setDeterministicUnpackOrderingFlag()), all members unpack
+ * in the order of peer ranks.
+ *
+ * The transactions of the members are not copied; members must not be
+ * changed or executed on their own while the group is communicating.
+ * All members must use the same MPI communicator, which the group also
+ * uses.  The group uses its own MPI tags (see setMPITag()) and ignores
+ * the tags and first message lengths of the members.  Like Schedule,
+ * the group adapts the first message length for each peer to the
+ * messages of its previous execution (see
+ * Schedule::setFirstMessageLength()), so a group should be kept and
+ * reused rather than rebuilt for each execution.
+ *
+ * The communication pattern of each group execution is recorded as one
+ * execution with the timer prefix "tbox::ScheduleGroup" when Schedule
+ * communication pattern recording is on.
+ *
+ * @see Schedule
+ */
+
+class ScheduleGroup
+{
+public:
+   /*!
+    * @brief Create an empty group.
+    */
+   ScheduleGroup();
+
+   /*!
+    * @brief Destructor.
+    *
+    * @pre !allocatedCommunicationObjects()
+    */
+   ~ScheduleGroup();
+
+   /*!
+    * @brief Append a schedule to the group.
+    *
+    * The schedule is executed after the schedules already in the group
+    * (see class description for the ordering guarantees).
+    *
+    * @pre schedule
+    * @pre !allocatedCommunicationObjects()
+    */
+   void
+   appendSchedule(
+      const std::shared_ptr<Schedule>& schedule);
+
+   /*!
+    * @brief Return the number of schedules in the group.
+    */
+   int
+   getNumberOfSchedules() const
+   {
+      return static_cast<int>(d_schedules.size());
+   }
+
+   /*!
+    * @brief Remove all schedules from the group.
+    *
+    * @pre !allocatedCommunicationObjects()
+    */
+   void
+   clear();
+
+   /*!
+    * @brief Specify MPI tag values to use in communication.
+    *
+    * See Schedule::setMPITag().  The defaults are those of Schedule.
+    *
+    * @pre first_tag >= 0
+    * @pre second_tag >= 0
+    */
+   void
+   setMPITag(
+      const int first_tag,
+      const int second_tag)
+   {
+      TBOX_ASSERT(first_tag >= 0);
+      TBOX_ASSERT(second_tag >= 0);
+      d_first_tag = first_tag;
+      d_second_tag = second_tag;
+   }
+
+   /*!
+    * @brief Specify the message length (in bytes) used in the first
+    * message when the receiving processor cannot determine the
+    * message length.
+    *
+    * See Schedule::setFirstMessageLength().
+    *
+    * @pre first_message_length > 0
+    */
+   void
+   setFirstMessageLength(
+      int first_message_length)
+   {
+      TBOX_ASSERT(first_message_length > 0);
+      d_first_message_length = static_cast<size_t>(first_message_length);
+   }
+
+   /*!
+    * @brief Perform the communication of all member schedules.
+    *
+    * This method is simply a <TT>beginCommunication()</TT> followed by
+    * <TT>finalizeCommunication()</TT>.
+    */
+   void
+   communicate();
+
+   /*!
+    * @brief Post the receives and send the packed messages of all
+    * member schedules.
+    *
+    * This method must be followed by a call to
+    * <TT>finalizeCommunication()</TT>.
+    */
+   void
+   beginCommunication();
+
+   /*!
+    * @brief Do the local copies of the members, complete the
+    * communication and unpack the received data.
+    */
+   void
+   finalizeCommunication();
+
+   /*!
+    * @brief Returns true if the communication objects have been allocated.
+    */
+   bool
+   allocatedCommunicationObjects() const
+   {
+      return d_coms != 0;
+   }
+
+   /*!
+    * @brief Print class data to the specified output stream.
+    */
+   void
+   printClassData(
+      std::ostream& stream) const;
+
+   /*!
+    * @brief Get the name of this object.
+    */
+   const std::string
+   getObjectName() const
+   {
+      return "ScheduleGroup";
+   }
+
+private:
+   ScheduleGroup(
+      const ScheduleGroup&);            // not implemented
+   ScheduleGroup&
+   operator = (
+      const ScheduleGroup&);            // not implemented
+
+   void
+   allocateCommunicationObjects();
+   void
+   deallocateCommunicationObjects();
+
+   void
+   postReceives();
+   void
+   postSends();
+
+   /*!
+    * @brief Set up the stream over the completed receive d_coms[irecv].
+    */
+   void
+   setUpRecvStream(
+      size_t irecv);
+
+   /*!
+    * @brief Unpack the transactions of member schedule imember from
+    * the message received from the peer of d_coms[irecv].
+    */
+   void
+   unpackMember(
+      size_t imember,
+      size_t irecv);
+
+   /*!
+    * @brief Write the communication pattern of the execution just
+    * completed to the Schedule communication pattern file.
+    */
+   void
+   recordCommPattern();
+
+   /*!
+    * @brief Set up things for the entire class.
+    *
+    * Only called by StartupShutdownManager.
+    */
+   static void
+   initializeCallback();
+
+   /*!
+    * @brief Free static timers.
+    *
+    * Only called by StartupShutdownManager.
+    */
+   static void
+   finalizeCallback();
+
+   /*!
+    * @brief Member schedules, in execution order.
+    */
+   std::vector<std::shared_ptr<Schedule> > d_schedules;
+
+   /*!
+    * @brief Ranks of the processes sending to and receiving from the
+    * local process, for the current execution, in increasing order.
+    */
+   std::vector<int> d_recv_ranks;
+   std::vector<int> d_send_ranks;
+
+   /*!
+    * @brief Peer-to-peer communication objects, one for each incoming
+    * message followed by one for each outgoing message.
+    */
+   AsyncCommPeer<char>* d_coms;
+
+   /*!
+    * @brief Stage for advancing communication operations to
+    * completion.
+    */
+   AsyncCommStage d_com_stage;
+
+   /*!
+    * @brief Streams over the received messages, one for each element
+    * of d_recv_ranks.  The members unpack from these in turn.
+    */
+   std::vector<std::shared_ptr<MessageStream> > d_recv_streams;
+
+   /*!
+    * @brief Message sizes (bytes) of the current execution, one for
+    * each send and receive.  Kept only while recording the
+    * communication pattern.
+    */
+   std::vector<size_t> d_recorded_send_sizes;
+   std::vector<size_t> d_recorded_recv_sizes;
+
+   SAMRAI_MPI d_mpi;
+   int d_first_tag;
+   int d_second_tag;
+   size_t d_first_message_length;
+
+   /*!
+    * @brief First message lengths adapted to the messages of the
+    * previous execution, by peer rank.
+    */
+   std::map<int, size_t> d_send_first_message_lengths;
+   std::map<int, size_t> d_recv_first_message_lengths;
+
+   static std::shared_ptr<Timer> t_communicate;
+   static std::shared_ptr<Timer> t_post_sends;
+   static std::shared_ptr<Timer> t_pack_stream;
+   static std::shared_ptr<Timer> t_unpack_stream;
+   static std::shared_ptr<Timer> t_local_copies;
+   static std::shared_ptr<Timer> t_MPI_wait;
+
+   static StartupShutdownManager::Handler
+      s_initialize_finalize_handler;
+
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,119 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2017 Lawrence Livermore National Security, LLC
+ * Description:   Contiguous block of memory handed out in pieces
+ *
+ ************************************************************************/
+#ifndef included_tbox_StorageArena
+#define included_tbox_StorageArena
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace SAMRAI {
+namespace tbox {
+
+/*!
+ * @brief Class StorageArena is a single block of memory handed out in
+ * consecutive pieces, so that many arrays can share one contiguous
+ * allocation.
+ *
+ * While an arena is active (see setActiveArena()), pdat::ArrayData
+ * objects take their storage from it instead of allocating their own.
+ * Pieces are aligned as by MemoryUtilities::align() and are never
+ * reused; each object using a piece holds a std::shared_ptr to the
+ * arena, so the block is freed when the last of them is destroyed.
+ *
+ * Only one arena is active at a time.  Activation is not thread-safe.
+ *
+ * @see hier::PatchLevel::allocatePatchData()
+ */
+
+class StorageArena
+{
+public:
+   /*!
+    * @brief Allocate a block of the given size.
+    *
+    * @param[in] bytes
+    */
+   explicit StorageArena(
+      size_t bytes);
+
+   /*!
+    * @brief Destructor frees the block.
+    */
+   ~StorageArena();
+
+   /*!
+    * @brief Return a piece of the given size, or 0 if the remainder of
+    * the block is too small.
+    *
+    * @param[in] bytes
+    */
+   void *
+   allocate(
+      size_t bytes);
+
+   /*!
+    * @brief Return the size of the block in bytes.
+    */
+   size_t
+   getSize() const
+   {
+      return d_size;
+   }
+
+   /*!
+    * @brief Return the number of bytes handed out so far.
+    */
+   size_t
+   getUsedSize() const
+   {
+      return d_used;
+   }
+
+   /*!
+    * @brief Set the arena from which storage is taken.
+    *
+    * Pass a null pointer to deactivate the arena.
+    */
+   static void
+   setActiveArena(
+      const std::shared_ptr<StorageArena>& arena)
+   {
+      s_active_arena = arena;
+   }
+
+   /*!
+    * @brief Return the active arena, which may be null.
+    */
+   static const std::shared_ptr<StorageArena>&
+   getActiveArena()
+   {
+      return s_active_arena;
+   }
+
+private:
+   StorageArena(
+      const StorageArena&);             // not implemented
+   StorageArena&
+   operator = (
+      const StorageArena&);             // not implemented
+
+   char* d_block;
+   size_t d_size;
+   size_t d_used;
+
+   static std::shared_ptr<StorageArena> s_active_arena;
+};
+
+}
+}
+
+#endif
@@ -14,6 +14,7 @@
 #include "SAMRAI/SAMRAI_config.h"
 #include "SAMRAI/tbox/Clock.h"
 #include "SAMRAI/tbox/Database.h"
+#include "SAMRAI/tbox/HardwareCounters.h"
 #include "SAMRAI/tbox/PIO.h"
 
 #include <string>
@@ -53,6 +54,11 @@ class TimerManager;
  * an input file or it was not explicitly made active by the user.  When
  * a timer is created, it is active by default.
  *
+ * A timer may also carry HardwareCounters, which count cycles,
+ * instructions and cache misses over the same start/stop intervals.
+ * TimerManager attaches them to the timers named in its counter_list
+ * input.  Timers without counters only test a null pointer.
+ *
  * Note that the constructor is protected so that timer objects can only
  * be created by the TimerManager class.
  *
@@ -274,6 +280,16 @@ public:
 #endif
    }
 
+   /**
+    * Return the hardware counters of this timer, or null if it has
+    * none.
+    */
+   const HardwareCounters *
+   getHardwareCounters() const
+   {
+      return d_counters.get();
+   }
+
    /**
     * Compute load balance efficiency based on wallclock (non-exclusive)
     * time.
@@ -327,6 +343,18 @@ protected:
 #endif
    }
 
+   /*
+    * Attach hardware counters to this timer.  Must not be called while
+    * the timer is running.
+    */
+   void
+   setHardwareCounters(
+      const std::shared_ptr<HardwareCounters>& counters)
+   {
+      TBOX_ASSERT(!d_is_running);
+      d_counters = counters;
+   }
+
    /**
     * Add Timer that running concurrently with this one.
     */
@@ -416,6 +444,11 @@ private:
     */
    int d_accesses;
 
+   /*
+    * Hardware counters measured with the times, or null.
+    */
+   std::shared_ptr<HardwareCounters> d_counters;
+
    static const int DEFAULT_NUMBER_OF_TIMERS_INCREMENT;
 
    /*
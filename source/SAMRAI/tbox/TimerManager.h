@@ -94,6 +94,12 @@ namespace tbox {
  *       timers themselves are not affecting the performance of your
  *       calculation.
  *
+ *    - \b    print_memory
+ *       Prints the memory accounted to each MemoryUtilities category
+ *       (patch data, box levels, connectors, schedules, ...), current
+ *       and peak, locally and reduced across all processors.  This
+ *       makes print() collective.
+ *
  *    - \b    print_threshold
  *       Timers that use up less than (<EM>print_threshold</EM>) percent of
  *       the overall run time are not printed.  This can be a convenient
@@ -105,6 +111,24 @@ namespace tbox {
  *       wildcards to turn on a set of timers in a given package or class: <br>
  *       timer_list = "pkg1::*::*", "pkg2::class2::*", ...
  *
+ *    - \b    counter_list
+ *       List of active timers that also measure hardware performance
+ *       counters (cycles, instructions, cache misses), in the same format
+ *       as timer_list.  The counters are read with Linux perf_event_open
+ *       and are only available if configure found <linux/perf_event.h>
+ *       and the kernel allows user-space counting.  print() then adds a
+ *       table with the counts and the derived instructions per cycle and
+ *       estimated memory bandwidth of each of these timers.  Timers not
+ *       in the list carry no counter overhead.
+ *
+ *    - \b    max_counter_groups
+ *       Maximum number of timers measuring hardware counters.  Each such
+ *       timer opens its own counter group, which uses file descriptors
+ *       and, beyond the number of counters of the processor, makes the
+ *       kernel multiplex the groups so the counts become scaled
+ *       estimates.  Matching timers beyond the limit get no counters and
+ *       a warning is printed once.
+ *
  * <b> Details: </b> <br>
  * <table>
  *   <tr>
@@ -204,6 +228,14 @@ namespace tbox {
  *     <td>Not written to restart.  Value in input db used.</td>
  *   </tr>
  *   <tr>
+ *     <td>print_memory</td>
+ *     <td>bool</td>
+ *     <td>FALSE</td>
+ *     <td>TRUE, FALSE</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart.  Value in input db used.</td>
+ *   </tr>
+ *   <tr>
  *     <td>print_threshold</td>
  *     <td>double</td>
  *     <td>0.25</td>
@@ -219,6 +251,22 @@ namespace tbox {
  *     <td>opt</td>
  *     <td>Not written to restart.  Value in input db used.</td>
  *   </tr>
+ *   <tr>
+ *     <td>counter_list</td>
+ *     <td>array of strings</td>
+ *     <td>none</td>
+ *     <td>N/A</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart.  Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>max_counter_groups</td>
+ *     <td>int</td>
+ *     <td>32</td>
+ *     <td>>=0</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart.  Value in input db used.</td>
+ *   </tr>
  * </table>
  *
  * A sample input file entry might look like:
@@ -465,6 +513,22 @@ private:
    printConcurrent(
       std::ostream& os);
 
+   /*
+    * Output hardware counters and derived metrics of the timers that
+    * have them.
+    */
+   void
+   printHardwareCounters(
+      std::ostream& os);
+
+   /*
+    * Attach hardware counters to the timer if its name matches an
+    * entry of d_counter_list.
+    */
+   void
+   attachHardwareCounters(
+      Timer& timer) const;
+
    /*
     * Build the timer_names, timer_values, and max_processor_id arrays.
     */
@@ -620,6 +684,19 @@ private:
    std::list<std::string> d_class_names;
    std::list<std::string> d_class_method_names;
 
+   /*
+    * Entries of the counter_list input, in package::class::method form
+    * with "*" wildcards.
+    */
+   std::vector<std::string> d_counter_list;
+
+   /*
+    * Limit on the hardware counter groups opened for d_counter_list and
+    * whether the warning that it was reached has been printed.
+    */
+   int d_max_counter_groups;
+   mutable bool d_counter_cap_reported;
+
    /*
     * These values hold the length of the package, class, and class_method
     * lists.  They are stored to avoid multiple calls to getNumberOfItems
@@ -673,6 +750,12 @@ private:
    bool d_print_concurrent;
    bool d_print_timer_overhead;
 
+   /*
+    * Print MemoryUtilities category accounting after the timers.
+    * Default:  d_print_memory=false;
+    */
+   bool d_print_memory;
+
    /*
     * Internal value used to set and grow arrays for storing
     * timers.
@@ -18,6 +18,7 @@
 #include "SAMRAI/xfer/CoarsenSchedule.h"
 #include "SAMRAI/xfer/CoarsenPatchStrategy.h"
 #include "SAMRAI/xfer/CoarsenTransactionFactory.h"
+#include "SAMRAI/xfer/VariableFillPattern.h"
 #include "SAMRAI/hier/PatchLevel.h"
 #include "SAMRAI/tbox/Utilities.h"
 
@@ -336,6 +337,13 @@ private:
     */
    std::shared_ptr<CoarsenClasses> d_coarsen_classes;
 
+   /*!
+    * Fill pattern used for the items registered without one.  All of
+    * them share this object, so schedules can tell that their fill
+    * patterns are the same.
+    */
+   std::shared_ptr<VariableFillPattern> d_default_fill_pattern;
+
    /*!
     * Tells if special behavior to pre-fill the temporary coarse level with
     * existing coarse data values is turned on.
@@ -27,6 +27,7 @@
 
 #include <iostream>
 #include <memory>
+#include <vector>
 
 namespace SAMRAI {
 namespace xfer {
@@ -125,7 +126,7 @@ public:
    /*!
     * @brief Read static data from input database.
     */
-   void
+   static void
    getFromInput();
 
    /*!
@@ -196,6 +197,30 @@ public:
    setScheduleGenerationMethod(
       const std::string& method);
 
+   /*!
+    * @brief Static function to set how the transactions of CoarsenSchedule
+    * objects constructed from now on are built.
+    *
+    * The options are read from the CoarsenSchedule input as
+    * DEV_threaded_construction, false by default, and DEV_share_overlaps,
+    * true by default.  They change only the work done to build a schedule,
+    * not the schedule, so this method is meant for tests that build the
+    * same schedule each way and compare.  Threaded construction calls the
+    * CoarsenTransactionFactory and the variable fill patterns from several
+    * threads at once, so enable it only when those are thread safe.
+    *
+    * @param[in] threaded  Construct the transactions for different
+    *                      destination boxes concurrently when OpenMP is
+    *                      enabled.
+    * @param[in] share_overlaps  Compute the overlaps once for equivalence
+    *                      classes whose data have the same box geometry
+    *                      and fill pattern.
+    */
+   static void
+   setConstructionOptions(
+      bool threaded,
+      bool share_overlaps);
+
    /*!
     * @brief Print the coarsen schedule state to the specified data stream.
     *
@@ -334,6 +359,11 @@ private:
     * @param[in] src_level      The temporary coarse level that will have
     *                           coarsened data
     * @param[in] src_box        Owned by a Patch on the temporary coarse level
+    * @param[out] transactions  The transactions are appended here, to be
+    *                           added to the schedule by the caller.
+    *
+    * This method does not change the schedule, so it can be called
+    * concurrently for different destination boxes.
     *
     * @pre dst_level
     * @pre src_level
@@ -347,7 +377,22 @@ private:
       const std::shared_ptr<hier::PatchLevel>& dst_level,
       const hier::Box& dst_box,
       const std::shared_ptr<hier::PatchLevel>& src_level,
-      const hier::Box& src_box);
+      const hier::Box& src_box,
+      std::vector<std::shared_ptr<tbox::Transaction> >& transactions) const;
+
+   /*!
+    * @brief Compute d_overlap_class for the current coarsen classes.
+    */
+   void
+   computeOverlapClasses();
+
+   /*!
+    * @brief Whether to construct the transactions for num_dst_boxes
+    * destination boxes with multiple threads.
+    */
+   static bool
+   useThreadedConstruction(
+      int num_dst_boxes);
 
    /*!
     * @brief Restructure the neighborhood sets from a src_to_dst Connector
@@ -419,6 +464,18 @@ private:
     */
    static bool s_extra_debug;
 
+   /*!
+    * @brief Flag to construct transactions for different destination
+    * boxes concurrently when OpenMP is enabled.
+    */
+   static bool s_threaded_construction;
+
+   /*!
+    * @brief Flag to compute overlaps once for equivalence classes whose
+    * overlaps are the same.  See d_overlap_class.
+    */
+   static bool s_share_overlaps;
+
    /*!
     * @brief Flag indicating if any RefineSchedule has read the input database
     * for static data.
@@ -482,6 +539,19 @@ private:
     */
    std::shared_ptr<tbox::Schedule> d_schedule;
 
+   /*!
+    * @brief For each equivalence class, the first equivalence class
+    * whose overlaps are the same.
+    *
+    * Classes that differ only in the coarsen operator stencil or in
+    * d_fine_bdry_reps_var have the same overlaps, which
+    * constructScheduleTransactions() computes once.  The classes must
+    * have the same box geometries (see
+    * hier::PatchDataFactory::hasSameBoxGeometry()) and the same fill
+    * pattern object.
+    */
+   std::vector<int> d_overlap_class;
+
    /*!
     * @brief Boolean indicating whether source data on the coarse temporary
     * level must be filled before coarsening operations (see comments for class
@@ -14,6 +14,10 @@
 #include "SAMRAI/SAMRAI_config.h"
 
 #include "SAMRAI/xfer/PatchLevelFillPattern.h"
+#include "SAMRAI/tbox/OpenMPUtilities.h"
+
+#include <map>
+#include <vector>
 
 namespace SAMRAI {
 namespace xfer {
@@ -27,6 +31,12 @@ namespace xfer {
  * The fill boxes will consist of the ghost regions lying outside of
  * the level interior--in other words the ghost regions at physical
  * and coarse-fine boundaries.
+ *
+ * The fill boxes of a destination box depend only on its extents, the
+ * ghost width and the positions of its neighbors relative to it, and
+ * this configuration repeats for most boxes of a uniformly tiled level
+ * and from one regrid to the next.  The fill boxes are therefore
+ * memoized relative to the destination box for each configuration.
  */
 
 class PatchLevelBorderFillPattern:public PatchLevelFillPattern
@@ -138,6 +148,26 @@ private:
     * @brief Maximum number of fill boxes across all destination patches.
     */
    int d_max_fill_boxes;
+
+   /*
+    * Fill boxes relative to the lower corner of the destination box,
+    * keyed by the ghost width, the extents of the destination box and
+    * its neighbors relative to its lower corner.
+    */
+   typedef std::map<std::vector<int>, hier::BoxContainer> MemoizedFillBoxes;
+
+   /*!
+    * @brief Largest number of configurations kept in
+    * d_memoized_fill_boxes.  The map is cleared when it is full.
+    */
+   static const int s_max_memoized_fill_boxes;
+
+   MemoizedFillBoxes d_memoized_fill_boxes;
+
+   /*!
+    * @brief OpenMP lock for d_memoized_fill_boxes.
+    */
+   TBOX_omp_lock_t l_memoized_fill_boxes;
 };
 
 }
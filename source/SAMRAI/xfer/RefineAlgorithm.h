@@ -685,6 +685,13 @@ private:
     */
    std::shared_ptr<RefineClasses> d_refine_classes;
 
+   /*!
+    * Fill pattern used for the items registered without one.  All of
+    * them share this object, so schedules can tell that their fill
+    * patterns are the same.
+    */
+   std::shared_ptr<VariableFillPattern> d_default_fill_pattern;
+
    /*!
     * Tells if any schedule has yet been created using this object.
     */
@@ -23,10 +23,12 @@
 #include "SAMRAI/hier/PatchHierarchy.h"
 #include "SAMRAI/hier/PatchLevel.h"
 #include "SAMRAI/tbox/Schedule.h"
+#include "SAMRAI/tbox/ScheduleGroup.h"
 #include "SAMRAI/tbox/Timer.h"
 
 #include <iostream>
 #include <memory>
+#include <vector>
 
 namespace SAMRAI {
 namespace xfer {
@@ -313,6 +315,48 @@ public:
     */
    void deallocateInternalData();
 
+   /*!
+    * @brief Static function to set how the transactions of RefineSchedule
+    * objects constructed from now on are built.
+    *
+    * The options are read from the RefineSchedule input as
+    * DEV_threaded_construction, false by default, and DEV_share_overlaps,
+    * true by default.  They change only the work done to build a schedule,
+    * not the schedule, so this method is meant for tests that build the
+    * same schedule each way and compare.  Threaded construction calls the
+    * RefineTransactionFactory and the variable fill patterns from several
+    * threads at once, so enable it only when those are thread safe.
+    *
+    * @param[in] threaded  Construct the transactions for different
+    *                      destination boxes concurrently when OpenMP is
+    *                      enabled.
+    * @param[in] share_overlaps  Compute the overlaps once for equivalence
+    *                      classes whose data have the same box geometry
+    *                      and fill pattern.
+    */
+   static void
+   setConstructionOptions(
+      bool threaded,
+      bool share_overlaps);
+
+   /*!
+    * @brief Static function to set whether RefineSchedule objects execute
+    * their coarse and fine priority level schedules together.
+    *
+    * The option is read from the RefineSchedule input as
+    * DEV_group_level_schedules, true by default.  It takes effect at the
+    * next fill, and only where the schedules can be grouped (see
+    * canGroupLevelSchedules()).  It changes only the messages sent, not
+    * the data filled, so this method is meant for tests that fill the
+    * same data each way and compare.
+    *
+    * @param[in] group_level_schedules  Execute the level schedules as one
+    *                                   tbox::ScheduleGroup when possible.
+    */
+   static void
+   setGroupLevelSchedules(
+      bool group_level_schedules);
+
    /*!
     * @brief Print the refine schedule data to the specified data stream.
     *
@@ -353,6 +397,42 @@ private:
    //! @brief Mapping from a (potentially remote) Box to a set of neighbors.
    typedef std::map<hier::Box, hier::BoxContainer, hier::Box::id_less> FullNeighborhoodSet;
 
+   /*!
+    * @brief A transaction made by constructScheduleTransactions() and
+    * where it goes in the level schedules.
+    */
+   struct TransactionRecord {
+      std::shared_ptr<tbox::Transaction> d_transaction;
+      //! Whether it goes in the fine (rather than coarse) priority schedule.
+      bool d_fine_priority;
+      //! Whether src and dst are the same patch (added, not appended).
+      bool d_same_patch;
+      //! Whether src and dst are both local (a local copy).
+      bool d_local;
+   };
+
+   /*!
+    * @brief Which transactions addTransactionRecords() adds.
+    */
+   enum RecordSelection {
+      ALL_RECORDS,
+      LOCAL_RECORDS,
+      REMOTE_RECORDS
+   };
+
+   /*!
+    * @brief Work space for constructScheduleTransactions().
+    *
+    * Each thread constructing transactions has its own, declared
+    * outside the loop so the memory is reused between calls.
+    */
+   struct TransactionWorkSpace {
+      //! Source masks, by equivalence class and fill box.
+      std::vector<hier::Box> d_src_masks;
+      //! Overlaps, by equivalence class and fill box.
+      std::vector<std::shared_ptr<hier::BoxOverlap> > d_overlaps;
+   };
+
    /*!
     * @brief This private constructor creates a communication schedule
     * that fills the destination level interior as well as ghost regions
@@ -413,7 +493,7 @@ private:
    /*!
     * @brief Read static data from input database.
     */
-   void
+   static void
    getFromInput();
 
    /*!
@@ -513,6 +593,18 @@ private:
       double fill_time,
       bool do_physical_boundary_fill) const;
 
+   /*!
+    * @brief Return whether the coarse and fine priority level schedules
+    * can be executed as one tbox::ScheduleGroup.
+    *
+    * This requires that nothing is interpolated from a coarser level
+    * between the two, and that no source of a fine priority item is the
+    * scratch component of a coarse priority item, since the group packs
+    * the sources of both before writing anything.
+    */
+   bool
+   canGroupLevelSchedules() const;
+
    /*!
     * @brief Fill the physical boundaries for each patch on d_dst_level.
     *
@@ -902,6 +994,13 @@ private:
     * @param[in] dst_box  Box from a destination patch.
     * @param[in] src_box  Box from a source patch.
     * @param[in] use_time_interpolation
+    * @param[in,out] work_space  Work space of the calling thread.
+    * @param[out] transactions  The transactions are appended here,
+    *                           to be added to the level schedules by
+    *                           addTransactionRecords().
+    *
+    * This method does not change the schedule, so it can be called
+    * concurrently for different destination boxes.
     *
     * @pre d_dst_level
     * @pre d_src_level
@@ -914,7 +1013,36 @@ private:
       hier::BoxNeighborhoodCollection::ConstNeighborIterator& nbrs_end,
       const hier::Box& dst_box,
       const hier::Box& src_box,
-      const bool use_time_interpolation);
+      const bool use_time_interpolation,
+      TransactionWorkSpace& work_space,
+      std::vector<TransactionRecord>& transactions) const;
+
+   /*!
+    * @brief Add transactions made by constructScheduleTransactions() to
+    * the level schedules, in order.
+    *
+    * @param[in] transactions
+    * @param[in] selection  Add all transactions, only local copies or
+    *                       only those with a remote src or dst.
+    */
+   void
+   addTransactionRecords(
+      const std::vector<TransactionRecord>& transactions,
+      RecordSelection selection = ALL_RECORDS);
+
+   /*!
+    * @brief Compute d_overlap_class for the current refine classes.
+    */
+   void
+   computeOverlapClasses();
+
+   /*!
+    * @brief Whether to construct the transactions for num_dst_boxes
+    * destination boxes with multiple threads.
+    */
+   static bool
+   useThreadedConstruction(
+      int num_dst_boxes);
 
    /*!
     * @brief Reorder the neighborhood sets from a src_to_dst Connector
@@ -1115,6 +1243,15 @@ private:
     */
    std::shared_ptr<tbox::Schedule> d_fine_priority_level_schedule;
 
+   /*!
+    * @brief Group executing d_coarse_priority_level_schedule and
+    * d_fine_priority_level_schedule together, created on first use.
+    * It is kept so that it adapts its message lengths across fills.
+    *
+    * @see canGroupLevelSchedules()
+    */
+   mutable std::shared_ptr<tbox::ScheduleGroup> d_level_schedule_group;
+
    /*!
     * @brief The coarse interpolation level is an internal level created to
     * hold data required for interpolating into the fill boxes of the
@@ -1258,22 +1395,17 @@ private:
     */
 
    /*!
-    * @brief Array to store overlaps used for construction of transactions.
-    *
-    * This is declared in the class to make memory management more
-    * efficient since constructScheduleTransactions is called many times.
-    *
-    * The size of the array is controlled by d_max_fill_boxes.
-    */
-   std::vector<std::shared_ptr<hier::BoxOverlap> > d_overlaps;
-
-   /*!
-    * @brief Source mask boxes used in construction of transactions.
+    * @brief For each equivalence class, the first equivalence class
+    * whose overlaps are the same.
     *
-    * Like d_overlaps, this is declared in the class to make memory
-    * management more efficient.
+    * Overlaps depend only on the box geometries of the scratch and
+    * source data (see hier::PatchDataFactory::hasSameBoxGeometry()) and
+    * on the variable fill pattern, not on everything that distinguishes
+    * equivalence classes, so constructScheduleTransactions() computes
+    * them once for all classes with the same box geometries and the
+    * same fill pattern object.
     */
-   hier::BoxContainer d_src_masks;
+   std::vector<int> d_overlap_class;
 
    /*!
     * @brief The maximum number of fill boxes across all patches in the
@@ -1334,6 +1466,25 @@ private:
     */
    static bool s_barrier_and_time;
 
+   /*!
+    * @brief Flag to execute the coarse and fine priority level schedules
+    * with one message per peer when possible.  See
+    * canGroupLevelSchedules().
+    */
+   static bool s_group_level_schedules;
+
+   /*!
+    * @brief Flag to construct transactions for different destination
+    * boxes concurrently when OpenMP is enabled.
+    */
+   static bool s_threaded_construction;
+
+   /*!
+    * @brief Flag to compute overlaps once for equivalence classes whose
+    * overlaps are the same.  See d_overlap_class.
+    */
+   static bool s_share_overlaps;
+
    /*!
     * @brief Flag indicating if any RefineSchedule has read the input database
     * for static data.
@@ -16,9 +16,12 @@
 #include "SAMRAI/hier/BoxGeometry.h"
 #include "SAMRAI/hier/BoxOverlap.h"
 #include "SAMRAI/hier/PatchDataFactory.h"
+#include "SAMRAI/tbox/OpenMPUtilities.h"
 
+#include <map>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace SAMRAI {
 namespace xfer {
@@ -38,6 +41,18 @@ namespace xfer {
  * this class may be used to restrict the filling of data to locations on or
  * near a patch boundary.
  *
+ * Schedules ask a fill pattern for the same overlaps many times: once
+ * per pair of patches for calculateOverlap() and once per destination
+ * patch for computeFillBoxesOverlap(), every time a schedule is built.
+ * The stencil of most fill patterns depends only on the extents of the
+ * destination patch box, and the fill boxes overlap depends only on the
+ * fill boxes and data box relative to the patch box.  Implementations
+ * may therefore memoize them with the protected find/memoize methods of
+ * this class, which store boxes relative to the lower corner of the
+ * patch box and translate them for every box with the same
+ * configuration.  The memoized boxes are guarded by a lock, since
+ * schedules may be constructed by several threads.
+ *
  * @see hier::BoxOverlap
  * @see RefineAlgorithm
  * @see RefineSchedule
@@ -131,6 +146,105 @@ public:
    virtual const std::string&
    getPatternName() const = 0;
 
+protected:
+   /*!
+    * @brief Find the stencil boxes memoized for boxes with the extents of
+    * dst_box, and set stencil_boxes to them translated to dst_box.
+    *
+    * @param[out] stencil_boxes  Stencil boxes, one container per
+    *                            container passed to memoizeStencilBoxes().
+    * @param[in]  dst_box        Box around which the stencil is wanted.
+    *
+    * @return true if stencil boxes were memoized for the extents of
+    * dst_box, false otherwise, in which case stencil_boxes is unchanged.
+    */
+   bool
+   findMemoizedStencilBoxes(
+      std::vector<hier::BoxContainer>& stencil_boxes,
+      const hier::Box& dst_box) const;
+
+   /*!
+    * @brief Find the stencil boxes memoized for boxes with the extents of
+    * dst_box, for stencils made of a single container.
+    */
+   bool
+   findMemoizedStencilBoxes(
+      hier::BoxContainer& stencil_boxes,
+      const hier::Box& dst_box) const;
+
+   /*!
+    * @brief Memoize the stencil boxes computed around dst_box for all
+    * boxes with the same extents.
+    */
+   void
+   memoizeStencilBoxes(
+      const std::vector<hier::BoxContainer>& stencil_boxes,
+      const hier::Box& dst_box) const;
+
+   /*!
+    * @brief Memoize the stencil boxes computed around dst_box, for
+    * stencils made of a single container.
+    */
+   void
+   memoizeStencilBoxes(
+      const hier::BoxContainer& stencil_boxes,
+      const hier::Box& dst_box) const;
+
+   /*!
+    * @brief Find the overlap boxes memoized by computeFillBoxesOverlap()
+    * for the same fill boxes, node fill boxes and data box relative to
+    * patch_box, and set overlap_boxes to them translated to patch_box.
+    *
+    * The arguments other than overlap_boxes are those of
+    * computeFillBoxesOverlap().
+    *
+    * @return true if overlap boxes were memoized for this configuration,
+    * false otherwise, in which case overlap_boxes is unchanged.
+    */
+   bool
+   findMemoizedFillBoxes(
+      std::vector<hier::BoxContainer>& overlap_boxes,
+      const hier::BoxContainer& fill_boxes,
+      const hier::BoxContainer& node_fill_boxes,
+      const hier::Box& patch_box,
+      const hier::Box& data_box) const;
+
+   /*!
+    * @brief Find the overlap boxes memoized by computeFillBoxesOverlap(),
+    * for overlaps made of a single container.
+    */
+   bool
+   findMemoizedFillBoxes(
+      hier::BoxContainer& overlap_boxes,
+      const hier::BoxContainer& fill_boxes,
+      const hier::BoxContainer& node_fill_boxes,
+      const hier::Box& patch_box,
+      const hier::Box& data_box) const;
+
+   /*!
+    * @brief Memoize the overlap boxes computed by computeFillBoxesOverlap()
+    * for all patches with the same configuration.
+    */
+   void
+   memoizeFillBoxes(
+      const std::vector<hier::BoxContainer>& overlap_boxes,
+      const hier::BoxContainer& fill_boxes,
+      const hier::BoxContainer& node_fill_boxes,
+      const hier::Box& patch_box,
+      const hier::Box& data_box) const;
+
+   /*!
+    * @brief Memoize the overlap boxes computed by computeFillBoxesOverlap(),
+    * for overlaps made of a single container.
+    */
+   void
+   memoizeFillBoxes(
+      const hier::BoxContainer& overlap_boxes,
+      const hier::BoxContainer& fill_boxes,
+      const hier::BoxContainer& node_fill_boxes,
+      const hier::Box& patch_box,
+      const hier::Box& data_box) const;
+
 private:
    VariableFillPattern(
       const VariableFillPattern&);                     // not implemented
@@ -138,6 +252,51 @@ private:
    operator = (
       const VariableFillPattern&);                     // not implemented
 
+   /*
+    * Boxes relative to the lower corner of a patch box, keyed by the
+    * configuration they were computed for.
+    */
+   typedef std::map<std::vector<int>, std::vector<hier::BoxContainer> >
+      MemoizedBoxes;
+
+   bool
+   findMemoizedBoxes(
+      std::vector<hier::BoxContainer>& boxes,
+      const MemoizedBoxes& memoized_boxes,
+      const std::vector<int>& key,
+      const hier::Box& patch_box) const;
+
+   void
+   memoizeBoxes(
+      MemoizedBoxes& memoized_boxes,
+      const std::vector<int>& key,
+      const std::vector<hier::BoxContainer>& boxes,
+      const hier::Box& patch_box) const;
+
+   /*!
+    * @brief Largest number of configurations memoized in each map.
+    *
+    * A map is emptied when the limit is reached, which only happens if
+    * the patch configurations keep changing.
+    */
+   static const int s_max_memoized_boxes;
+
+   /*!
+    * @brief Stencil boxes keyed by the extents of the destination box.
+    */
+   mutable MemoizedBoxes d_memoized_stencil_boxes;
+
+   /*!
+    * @brief Fill boxes overlaps keyed by the fill boxes, node fill boxes
+    * and data box relative to the patch box.
+    */
+   mutable MemoizedBoxes d_memoized_fill_boxes;
+
+   /*!
+    * @brief OpenMP lock for the memoized boxes.
+    */
+   mutable TBOX_omp_lock_t l_memoized_boxes;
+
 };
 
 }
@@ -196,8 +196,8 @@ public:
    /*!
     * @brief Compute the error of the current solution.
     *
-    * Compute the @f$L_2@f$ and @f$L_\infty@f$ norms of the error,
-    * for each level and over all levels.
+    * Compute the @f$L_2@f$ and @f$L_\infty@f$ norms of the error
+    * in one depth of the solution, for each level and over all levels.
     */
    int
    computeError(
@@ -205,7 +205,20 @@ public:
       /*! L2 norm */ double* l2norm,
       /*! L-inf norm */ double* linorm,
       /*! L2 norm on each level */ std::vector<double>& l2norms,
-      /*! L-inf norm on each level */ std::vector<double>& linorms) const;
+      /*! L-inf norm on each level */ std::vector<double>& linorms,
+      /*! depth of the solution */ int depth = 0) const;
+
+   /*!
+    * @brief Return the depth of the solution.
+    *
+    * Every depth is solved for the same exact solution as one
+    * right-hand side of a batched solve.
+    */
+   int
+   getDepth() const
+   {
+      return d_depth;
+   }
 
    /*!
     * @brief Compute error estimator (for adaption or plotting).
@@ -221,6 +234,12 @@ private:
    std::string d_name;
    const tbox::Dimension d_dim;
 
+   /*!
+    * @brief Depth of the solution, source, right-hand side and exact
+    * solution.
+    */
+   const int d_depth;
+
    std::shared_ptr<hier::PatchHierarchy> d_hierarchy;
 
    //@{
@@ -222,6 +222,10 @@ public:
     * Set the data in ghost cells corresponding to physical boundary
     * conditions.  Specific boundary conditions are determined by
     * information specified in input file and numerical routines.
+    * The ghost cells are filled by the FORTRAN routines one variable at
+    * a time unless the input parameter "use_batched_boundary_fill" is
+    * true, in which case all variables are filled by one call to
+    * appu::CartesianBoundaryUtilities2/3::fillBoundaryData().
     */
    void
    setPhysicalBoundaryConditions(
@@ -523,6 +527,10 @@ private:
     *    d_corner_transport .... type of finite difference approximation
     *                            for 3d transverse flux correction
     *
+    *    d_use_batched_boundary_fill .. fill physical boundary ghost cells
+    *                            of all variables with one batched C++ call
+    *                            instead of the per-variable FORTRAN fills
+    *
     *    d_nghosts ............. number of ghost cells for cell-centered
     *                            and face/side-centered variables
     *
@@ -533,6 +541,7 @@ private:
    int d_riemann_solve_int;
    int d_godunov_order;
    string d_corner_transport;
+   bool d_use_batched_boundary_fill;
    hier::IntVector d_nghosts;
    hier::IntVector d_fluxghosts;
 
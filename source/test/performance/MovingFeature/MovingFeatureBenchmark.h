@@ -0,0 +1,257 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2017 Lawrence Livermore National Security, LLC
+ * Description:   Physics-free AMR benchmark with moving tag features.
+ *
+ ************************************************************************/
+#ifndef included_MovingFeatureBenchmark
+#define included_MovingFeatureBenchmark
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/geom/CartesianGridGeometry.h"
+#include "SAMRAI/hier/PatchHierarchy.h"
+#include "SAMRAI/hier/PatchLevel.h"
+#include "SAMRAI/mesh/StandardTagAndInitStrategy.h"
+#include "SAMRAI/pdat/CellVariable.h"
+#include "SAMRAI/tbox/Database.h"
+#include "SAMRAI/tbox/Timer.h"
+#include "SAMRAI/xfer/CoarsenAlgorithm.h"
+#include "SAMRAI/xfer/CoarsenSchedule.h"
+#include "SAMRAI/xfer/RefineAlgorithm.h"
+#include "SAMRAI/xfer/RefinePatchStrategy.h"
+#include "SAMRAI/xfer/RefineSchedule.h"
+
+#include "test/testlib/MeshGenerationStrategy.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace SAMRAI;
+
+/*!
+ * @brief Physics-free application exercising the AMR infrastructure
+ * the way a time-dependent simulation does.
+ *
+ * Analytic tag features (spherical shells, sinusoidal fronts, ...)
+ * supplied by a MeshGenerationStrategy move through the domain with
+ * simulation time.  Each step the benchmark fills ghost cells of a
+ * configurable number of cell-centered variables on every level and
+ * synchronizes each level with its coarser level by coarsening.  The
+ * driver regrids periodically through mesh::GriddingAlgorithm, which
+ * calls back into this class for tagging and for initializing data on
+ * the new levels.  No numerical kernels are computed, so the measured
+ * costs belong to the SAMRAI infrastructure alone.
+ *
+ * Costs are accumulated in the following timers, which
+ * printPhaseSummary() reduces across ranks and reports:
+ * - apps::MovingFeatureBenchmark::tag
+ * - apps::MovingFeatureBenchmark::initialize_level_data
+ * - apps::MovingFeatureBenchmark::schedule_setup
+ * - apps::MovingFeatureBenchmark::ghost_fill
+ * - apps::MovingFeatureBenchmark::coarsen_sync
+ *
+ * Inputs:
+ *
+ * num_variables: Number of cell-centered double variables.  Default 1.
+ *
+ * depth: Depth of each variable.  Default 1.
+ *
+ * ghost_width: Ghost cell width of each variable.  Default 1.
+ *
+ * refine_operator: Name of the refine operator used in ghost fills and
+ * in initializing new levels.  Default "CONSERVATIVE_LINEAR_REFINE".
+ *
+ * coarsen_operator: Name of the coarsen operator used in the coarsen
+ * syncs.  Default "CONSERVATIVE_COARSEN".
+ */
+class MovingFeatureBenchmark:
+   public mesh::StandardTagAndInitStrategy,
+   public xfer::RefinePatchStrategy
+{
+
+public:
+   /*!
+    * @brief Constructor.
+    *
+    * @param[in] object_name
+    * @param[in] dim
+    * @param[in] grid_geometry Geometry providing the transfer operators.
+    * @param[in] mesh_gen Source of the analytic tag features.
+    * @param[in] database Input database (may be null).
+    */
+   MovingFeatureBenchmark(
+      const std::string& object_name,
+      const tbox::Dimension& dim,
+      const std::shared_ptr<geom::CartesianGridGeometry>& grid_geometry,
+      const std::shared_ptr<MeshGenerationStrategy>& mesh_gen,
+      const std::shared_ptr<tbox::Database>& database =
+         std::shared_ptr<tbox::Database>());
+
+   ~MovingFeatureBenchmark();
+
+   /*!
+    * @brief Fill ghost cells of all variables on all levels.
+    *
+    * Each level is filled from its own interior and from interpolated
+    * data on the next coarser level.
+    */
+   void
+   fillGhosts(
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+      double fill_time);
+
+   /*!
+    * @brief Synchronize all levels, finest first, by coarsening each
+    * level onto its next coarser level.
+    */
+   void
+   coarsenSync(
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy);
+
+   /*!
+    * @brief Reduce the phase timers across ranks and write a summary.
+    *
+    * @param[in] os
+    * @param[in] num_steps Number of steps taken, for the per-step costs.
+    */
+   void
+   printPhaseSummary(
+      std::ostream& os,
+      int num_steps) const;
+
+   int
+   getNumberOfVariables() const
+   {
+      return static_cast<int>(d_var_ids.size());
+   }
+
+   //@{ @name SAMRAI::mesh::StandardTagAndInitStrategy virtuals
+
+   void
+   initializeLevelData(
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+      const int level_number,
+      const double init_data_time,
+      const bool can_be_refined,
+      const bool initial_time,
+      const std::shared_ptr<hier::PatchLevel>& old_level =
+         std::shared_ptr<hier::PatchLevel>(),
+      const bool allocate_data = true);
+
+   void
+   resetHierarchyConfiguration(
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+      const int coarsest_level,
+      const int finest_level);
+
+   void
+   applyGradientDetector(
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+      const int level_number,
+      const double error_data_time,
+      const int tag_index,
+      const bool initial_time,
+      const bool uses_richardson_extrapolation);
+
+   //@}
+
+   //@{ @name SAMRAI::xfer::RefinePatchStrategy virtuals
+
+   /*!
+    * @brief Set physical boundary ghosts to a constant.
+    *
+    * The benchmark has no physics, so the boundary values only need to
+    * be defined.  The cost is small next to the communication.
+    */
+   void
+   setPhysicalBoundaryConditions(
+      hier::Patch& patch,
+      const double fill_time,
+      const hier::IntVector& ghost_width_to_fill);
+
+   hier::IntVector
+   getRefineOpStencilWidth(
+      const tbox::Dimension& dim) const
+   {
+      return hier::IntVector::getZero(dim);
+   }
+
+   void
+   preprocessRefine(
+      hier::Patch& fine,
+      const hier::Patch& coarse,
+      const hier::Box& fine_box,
+      const hier::IntVector& ratio)
+   {
+      NULL_USE(fine);
+      NULL_USE(coarse);
+      NULL_USE(fine_box);
+      NULL_USE(ratio);
+   }
+
+   void
+   postprocessRefine(
+      hier::Patch& fine,
+      const hier::Patch& coarse,
+      const hier::Box& fine_box,
+      const hier::IntVector& ratio)
+   {
+      NULL_USE(fine);
+      NULL_USE(coarse);
+      NULL_USE(fine_box);
+      NULL_USE(ratio);
+   }
+
+   //@}
+
+private:
+   /*
+    * Set the analytic value of all variables on a level.
+    */
+   void
+   computeLevelData(
+      hier::PatchLevel& level,
+      double data_time) const;
+
+   std::string d_object_name;
+
+   const tbox::Dimension d_dim;
+
+   std::shared_ptr<MeshGenerationStrategy> d_mesh_gen;
+
+   /*!
+    * @brief The benchmark variables and their patch data indices.
+    */
+   std::vector<std::shared_ptr<pdat::CellVariable<double> > > d_vars;
+   std::vector<int> d_var_ids;
+
+   /*!
+    * @brief Ghost fill, level initialization and coarsen algorithms,
+    * covering all variables.
+    */
+   std::shared_ptr<xfer::RefineAlgorithm> d_fill_alg;
+   std::shared_ptr<xfer::RefineAlgorithm> d_init_alg;
+   std::shared_ptr<xfer::CoarsenAlgorithm> d_coarsen_alg;
+
+   /*!
+    * @brief Schedules for each level, rebuilt after every regrid.
+    *
+    * d_coarsen_scheds[ln] coarsens level ln onto level ln-1.
+    */
+   std::vector<std::shared_ptr<xfer::RefineSchedule> > d_fill_scheds;
+   std::vector<std::shared_ptr<xfer::CoarsenSchedule> > d_coarsen_scheds;
+
+   std::shared_ptr<tbox::Timer> t_tag;
+   std::shared_ptr<tbox::Timer> t_initialize_level_data;
+   std::shared_ptr<tbox::Timer> t_schedule_setup;
+   std::shared_ptr<tbox::Timer> t_ghost_fill;
+   std::shared_ptr<tbox::Timer> t_coarsen_sync;
+
+};
+
+#endif  // included_MovingFeatureBenchmark